@@ -99,9 +99,6 @@
 // or 256 on PAL (non-interlaced).
 // NOTE: PAL vertical playfield resolutions > 256 may cause issues.
 
-#define	NTSC		(0)
-#define	PAL		(1)
-
 // Wait until end of active area has been displayed for num_frames (to avoid updating during display)
 void WaitEndDisplay(uint16_t num_frames = 1);
 
@@ -16,96 +16,142 @@ extern "C" void 	(*save_line_handler)();	// saved scan-line generation function
 extern PROGMEM const int8_t SinTable[] __attribute__ ((aligned(256)));
 extern PROGMEM const int8_t TriTable[] __attribute__ ((aligned(256)));
 extern PROGMEM const int8_t NoiseTable[] __attribute__ ((aligned(256)));
-extern "C" uint8_t	vol0;
-extern "C" uint8_t	wave0;
-extern "C" uint16_t	pos0;
-extern "C" uint16_t	freq0;
-extern "C" uint8_t	vol1;
-extern "C" uint8_t	wave1;
-extern "C" uint16_t	pos1;
-extern "C" uint16_t	freq1;
-extern "C" uint8_t	vol2;
-extern "C" uint8_t	wave2;
-extern "C" uint16_t	pos2;
-extern "C" uint16_t	freq2;
-
-uint8_t		vol0 __attribute__((used));
-uint8_t		wave0  __attribute__((used)) = ((uint16_t)&SinTable[0])>>8;
-uint16_t	pos0 __attribute__((used));
-uint16_t	freq0  __attribute__((used));
-uint8_t		vol1  __attribute__((used));
-uint8_t		wave1  __attribute__((used))= ((uint16_t)&SinTable[0])>>8;
-uint16_t	pos1 __attribute__((used));
-uint16_t	freq1  __attribute__((used));
-uint8_t		vol2  __attribute__((used));
-uint8_t		wave2  __attribute__((used)) = ((uint16_t)&TriTable[0])>>8;
-uint16_t	pos2 __attribute__((used));
-uint16_t	freq2  __attribute__((used));
-//void mixaudio(void) __attribute__ ((noinline));
-#define LINE_START_HANDLER()	mixaudio()
+#define AUDIO_VOICES		3		// (1-8) voices mixed each sample (costs 6 bytes SRAM each)
+#define AUDIO_VOLUME		1		// (0/1) per voice volume
+#define AUDIO_PHASE24		0		// (0/1) 16.8 phase for samples longer than 256 bytes
+#define AUDIO_NOISE		1		// (0/1) LFSR noise voice (game screen engine rumble, costs 5 bytes SRAM)
+#define AUDIO_MUSIC		1		// (0/1) pattern sequencer (title screen tune, costs 4*AUDIO_VOICES+9 bytes SRAM)
+#define AUDIO_ENVELOPE		1		// (0/1) ADSR, pitch slide and vibrato envelopes (costs 8*AUDIO_VOICES bytes SRAM)
+#define AUDIO_SAMPLES		(RAMEND > 0x8FF)	// (0/1) one-shot PCM/ADPCM sample voice (needs AUDIO_BUFFERED, costs 10 bytes SRAM)
+#define AUDIO_SFX		1		// (0/1) sound effect voice allocator (title screen bonk, costs 3*AUDIO_VOICES+1 bytes SRAM)
+#define AUDIO_TIMER		0		// (0/1) play buffered samples from a timer 0 interrupt every AUDIO_TIMER_CYCLES instead of each scanline
+#define AUDIO_TIMER_CYCLES	1008		// (912-2048, multiple of 8) CPU cycles per sample with AUDIO_TIMER (1008 = 15873Hz, above NTSC and PAL line rates)
+#if AUDIO_TIMER
+#define AUDIO_RATE		(F_CPU / (double)AUDIO_TIMER_CYCLES)	// samples per second (instead of scanline rate)
+#endif
+#include "AVRInvaders_audio.h"	// wave table voice mixer
 
-static inline void mixaudio(void)
+#define AUDIO_BENCHMARK		0		// (0/1) print measured mix cycles with mulsu and shift-and-add volume on serial at startup
+#define AUDIO_BUFFERED		(RAMEND > 0x8FF)	// (0/1) loop() mixes samples into audio_buf, scanline ISR only plays them (costs 260 bytes SRAM)
+#define AUDIO_JITTER		0		// (0/1) print worst scanline interrupt latency (cycles before handler starts) every 256 frames (with AUDIO_BUFFERED, costs 2 bytes SRAM)
+
+#if AUDIO_SAMPLES && !AUDIO_BUFFERED
+#error AUDIO_SAMPLES needs AUDIO_BUFFERED
+#endif
+#if AUDIO_TIMER && !AUDIO_BUFFERED
+#error AUDIO_TIMER needs AUDIO_BUFFERED
+#endif
+
+#if AUDIO_BUFFERED
+extern "C" uint8_t	audio_buf[256];		// sample ring buffer (one sample per scanline, or timer tick with AUDIO_TIMER)
+extern "C" uint8_t	audio_read;		// next sample to play (ISR)
+extern "C" uint8_t	audio_write;		// next sample to mix (loop), buffer empty when equal to audio_read
+extern "C" uint8_t	audio_underruns;	// scanlines (or timer ticks) with no sample ready
+#endif
+#if AUDIO_JITTER
+extern "C" uint16_t	line_latency;		// worst TCNT1 at scanline handler start (cycles since timer 1 overflow)
+#endif
+#define LINE_START_HANDLER()	line_start()
+
+#if AUDIO_BUFFERED
+// play next buffered sample (in scanline ISR)
+static inline void playaudio(void)
 {
-#if 1
-	uint8_t b;
-	__asm__ __volatile__
-	(
-		"		lds	r30,pos0+1\n"		// XL = pos0>>8
-		"		lds	r31,pos0\n"
-		"		lds	r18,freq0\n"
-		"		lds	r19,freq0+1\n"
-		"		add	r31,r18\n"
-		"		adc	r19,r30\n"
-		"		sts	pos0,r31\n"
-		"		sts	pos0+1,r19\n"
-		"		lds	r31,wave0\n"		// XH = wave address (high, 256 byte aligned)
-		"		lpm	r18,Z\n"			// XL = wave byte (signed 8-bits)
-		"		lds	r19,vol0\n"			// XH = volume
-		"		mulsu r18,r19\n"		// apply volume
-		"		mov	%[b],r1\n"			// keep high of result
-		
-		"		lds	r30,pos1+1\n"		// XL = pos0>>8
-		"		lds	r31,pos1\n"
-		"		lds	r18,freq1\n"
-		"		lds	r19,freq1+1\n"
-		"		add	r31,r18\n"
-		"		adc	r19,r30\n"
-		"		sts	pos1,r31\n"
-		"		sts	pos1+1,r19\n"
-		"		lds	r31,wave1\n"		// XH = wave address (high, 256 byte aligned)
-		"		lpm	r18,Z\n"			// XL = wave byte (signed 8-bits)
-		"		lds	r19,vol1\n"			// XH = volume
-		"		mulsu r18,r19\n"		// apply volume
-		"		add	%[b],r1\n"
-		"		lds	r30,pos2+1\n"		// XL = pos0>>8
-		"		lds	r31,pos2\n"
-		"		lds	r18,freq2\n"
-		"		lds	r19,freq2+1\n"
-		"		add	r31,r18\n"
-		"		adc	r19,r30\n"
-		"		sts	pos2,r31\n"
-		"		sts	pos2+1,r19\n"
-		"		lds	r31,wave2\n"		// XH = wave address (high, 256 byte aligned)
-		"		lpm	r18,Z\n"			// XL = wave byte (signed 8-bits)
-		"		lds	r19,vol2\n"			// XH = volume
-		"		mulsu r18,r19\n"		// apply volume
-		"		add	%[b],r1\n"
-		"		eor	r1,r1\n"
-		"		subi %[b],-128\n"
-		
-		: [b] "=r" (b)					// outputs
-		:								// inputs (none)
-		: "r18", "r19", "r20", "r30", "r31" // registers clobbered
-	);
-	OCR2A = b;
+	uint8_t r = audio_read;
+	if (r != audio_write)
+	{
+		OCR2A = audio_buf[r];
+		audio_read = r + 1;
+	}
+	else
+	{
+		audio_underruns++;			// keep last sample
+	}
+}
+
+// mix samples until buffer is full (call at least twice a frame, buffer is shorter than a frame, see mixaudio_until_display)
+static void mixaudio_buffer(void)
+{
+	uint8_t w = audio_write;
+	uint8_t end = audio_read - 1;			// leave one slot empty
+#if AUDIO_SAMPLES
+	int8_t pcm[32];					// sample voice decoded in batches
+	while (w != end)
+	{
+		uint8_t n = end - w;
+		if (n > sizeof (pcm))
+			n = sizeof (pcm);
+		audio_sample_decode(pcm, n);
+		for (uint8_t i = 0; i < n; i++)
+			audio_buf[w++] = audio_sample_add(mixsample(), pcm[i]);
+		audio_write = w;			// ISR can play batch
+	}
 #else
-	int8_t s0 = ((int8_t)pgm_read_byte((wave0<<8)+(uint8_t)(pos0>>8))*(int8_t)vol0)>>8;
-	int8_t s1 = ((int8_t)pgm_read_byte((wave1<<8)+(uint8_t)(pos1>>8))*(int8_t)vol1)>>8;
-	OCR2A = (s0 + s1) + 128;
-	pos0 += freq0;
-	pos1 += freq1;
+	while (w != end)
+	{
+		audio_buf[w++] = mixsample();
+	}
+	audio_write = w;
 #endif
 }
+#else
+// mix and play one sample (in scanline ISR)
+static inline void mixaudio(void)
+{
+	OCR2A = mixsample();
+}
+#endif
+
+#if AUDIO_TIMER
+// Play samples at a fixed rate (timer 2 stays the PWM output, timer 0 in CTC mode is the sample clock).  The
+// scanline interrupt runs with interrupts off for most of each visible line (about 900 cycles: output delay plus 22
+// tiles at 32 cycles), so the sample period must be longer than that or timer ticks are lost (and playback slows),
+// which sets the 912 cycle lower bound of AUDIO_TIMER_CYCLES.  The default 1008 keeps about 100 cycles of margin and
+// only mixes 1% more samples than NTSC scanline audio.  This interrupt (about 40 cycles) delays the scanline interrupt
+// by up to its own length, which the line renderer absorbs (it waits for TCNT1 before output, about 167 cycles of
+// margin), see AUDIO_JITTER to measure it on the target.
+ISR(TIMER0_COMPA_vect)
+{
+	playaudio();
+}
+#endif
+
+// scanline handler start (in scanline ISR)
+static inline void line_start(void)
+{
+#if AUDIO_JITTER
+	uint16_t t = TCNT1;
+	if (t > line_latency)
+		line_latency = t;
+#endif
+#if !AUDIO_BUFFERED
+	mixaudio();
+#elif !AUDIO_TIMER
+	playaudio();
+#endif
+}
+
+#if AUDIO_BENCHMARK
+// Cycles to mix one sample (timer 1 counts CPU cycles within a scan line)
+template <bool MulFree>
+static uint16_t bench_mix()
+{
+	volatile uint8_t b;
+	uint16_t t0, t1, t2;
+	uint8_t sreg = SREG;
+	cli();
+	do
+	{
+		t0 = TCNT1;
+		t1 = TCNT1;				// timer read overhead
+		b = audio_mix<AUDIO_VOICES, MulFree>::sum();
+		t2 = TCNT1;
+	} while (t2 < t0);				// retry if line wrapped
+	SREG = sreg;
+	(void)b;
+	return (t2 - t1) - (t1 - t0);
+}
+#endif
 
 // This will be executed after each scanline
 #define LINE_END_HANDLER()	\
@@ -130,6 +176,54 @@ static void blank_line()
 
 #include "AVRInvaders.h"	// video display
 
+#if AUDIO_BUFFERED
+uint8_t		audio_buf[256];
+uint8_t		audio_read;
+uint8_t		audio_write;
+uint8_t		audio_underruns;
+uint8_t		audio_frames;		// frames since underruns were printed
+#endif
+#if AUDIO_JITTER
+uint16_t	line_latency;
+#endif
+audio_voice	audio_voices[AUDIO_VOICES];
+#if AUDIO_NOISE
+audio_noise_voice	audio_noise = { 0, 0, 0xace1, 0 };
+#endif
+#if AUDIO_ENVELOPE
+audio_envelope_state	audio_envelopes[AUDIO_VOICES];
+#endif
+#if AUDIO_SAMPLES
+audio_sample_state	audio_sample_voice;
+#endif
+#if AUDIO_SFX
+audio_sfx_state		audio_sfx;
+#endif
+#if AUDIO_MUSIC
+audio_music_state	audio_music;
+#endif
+
+#if AUDIO_BUFFERED
+// The buffer holds less than a frame, so keep it full until the display starts (loop() has no time to mix during
+// display).  It then only has to last the display and the start of the next loop(), however little work a frame has.
+static_assert((SCREEN_HEIGHT + 1 + 16) * (AUDIO_TIMER ? CYCLES_LINE / AUDIO_TIMER_CYCLES : 1) < 255,
+	"audio_buf too short for display (16 lines margin for loop() to first mixaudio_buffer())");
+
+static void mixaudio_until_display(void)
+{
+	for (;;)
+	{
+		mixaudio_buffer();
+		uint8_t sreg = SREG;
+		cli();
+		uint16_t l = scan_line;
+		SREG = sreg;
+		if (l >= START_RENDER && l < END_RENDER)
+			break;
+	}
+}
+#endif
+
 // CAUTION: It is important not to define any variables or data above this point (which is why "extern" is used above)
 //          This is because the SRAM character set address must on a 256 byte boundary.  If it is the very first thing
 //	    defined (as it is in the library header) then it will be located at exactly 0x100 (wasting no space).
@@ -377,349 +471,219 @@ static uint16_t lfsr16()
 // Pseudo-sprite support routines (using dynamically defined SRAM characters) 
 //============================================================================
 
-// dynamically changing sprite info (in SRAM)
-struct sprite_ram
-{
-	uint8_t		def;
-	uint8_t		x, y;			// x, y pixel position of upper left corner of sprite
-};
-
-// unchanging sprite info (in flash ROM)
-struct sprite_rom
-{
-	int8_t		w, h;
-	const uint8_t	*image[8];
-};
-
-#include "test_sprites.h"
-
 #define BLANK_TILE	0
 
 #define MAX_SPRITES	8
 #define MAX_SAVE_TILES	96
 
+#define SPRITE_BENCHMARK	0		// (0/1) print average sprites.draw() cycles on serial every 64 frames
+#define FRAME_GOVERNOR		1		// (0/1) defer HUD and shed sprites (by gov_ranks) when frame work would run past START_RENDER (costs 11 bytes SRAM)
+#define GOV_MIN_SPRITES		2		// sprites never shed by governor (lowest gov_ranks have highest priority)
+#define GOV_MARGIN_LINES	4		// scan lines kept spare before START_RENDER
+#define SPRITE_BG_LAYER		(RAMEND > 0x8FF)	// (0/1) restore sprite cells from a background tilemap instead of save_tiles (costs H_CHARS*V_CHARS bytes SRAM)
+#define SPRITE_COLLISION	0		// (0=off) RAM tiles tracked for pixel collisions while compositing, e.g. 16 (costs 9*SPRITE_COLLISION+MAX_SPRITES+9 bytes SRAM, +SPRITE_COLLISION with meta-sprites)
+#define SPRITE_SORT		0		// (0/1) draw sprites in Y order, lower sprites on top (costs MAX_SPRITES bytes SRAM)
+#define SPRITE_ROW_TILES	0		// (0=off) max sprite RAM tiles per tile row, sprites over it are disabled (costs V_CHARS bytes SRAM)
+#define SPRITE_ANIM		(RAMEND > 0x8FF)	// (0/1) animate() steps sprites through crunch_sprites -a animations (costs 3*MAX_SPRITES bytes SRAM)
+#define SPRITE_PRIORITY		1		// (0/1) background pixels set in sprites.set_priority() mask table hide sprites (costs 1 byte SRAM)
+#define SPRITE_BITMAP		(RAMEND > 0x8FF)	// (0/1) sprites.plot(), line() etc. draw pixels into RAM tiles (costs 4 bytes SRAM)
+#define SPRITE_MISSILES		((RAMEND > 0x8FF) ? 2 : 0)	// (0=off) missiles (up to 8x8 pixel bullets from SRAM line bytes) drawn after sprites (costs 12*SPRITE_MISSILES+4 bytes SRAM)
+#define SPRITE_REGIONS		(RAMEND > 0x8FF)	// (0/1) clip each sprite to its own sprite_region from sprite_regions (costs MAX_SPRITES+5 bytes SRAM)
+
 #define CLIP_LEFT	((0)*8)
 #define CLIP_RIGHT	((H_CHARS-1)*8)
 #define CLIP_TOP	((0)*8)
-#define CLIP_BOTTOM	(((V_CHARS-3)*8)+v_fine_scroll)
-
-sprite_ram	sprite_info[MAX_SPRITES];
-char		save_tiles[MAX_SAVE_TILES];
+#define CLIP_BOTTOM	((V_CHARS-3)*8)			// (plus v_fine_scroll)
+#define HUD_TOP		((V_CHARS-2)*8)			// HUD rows at bottom of screen
 
-uint8_t next_sram_tile;
+#include "AVRInvaders_sprites.h"	// sprite engine
 
-static void draw_sprites()
-{
-	// draw screen
-	for (int8_t s = 0; s < MAX_SPRITES; s++)
-	{
-		sprite_ram *sinfo = &sprite_info[s];
-		uint8_t def = sinfo->def-1;
-		// skip zero or invalid sprite
-		if (def >= SPRITE_NUM_IMAGES)
-		{
-			continue;
-		}
+#include "test_sprites.h"
 
-		const sprite_rom *sdef = &sprite_def[def];
+#if AUDIO_MUSIC
+#include "title_music.h"			// from title_music.txt (see make_music.cmd)
+#endif
+#if AUDIO_SAMPLES
+#include "zap_sample.h"				// from zap.wav (see make_music.cmd, resampled for NTSC scanline rate so
+						// AUDIO_TIMER or PAL play it about 1% off pitch unless made with crunch_sample -r)
+#endif
 
-		// X calculations
-		uint8_t x = sinfo->x;
-		uint8_t w = pgm_read_byte(&sdef->w);
-		uint8_t oh = pgm_read_byte(&sdef->h);				// original height
-		const uint8_t *sdat = pgm_read_word(&sdef->image[x & 0x7]);	// select pre-shifted sprite data
-		
-		// if X off right or left edge 
-		uint8_t xw = x + w;
-		if (
-#if CLIP_LEFT > 0	// avoid warning if CLIP_LEFT 0
-		x < CLIP_LEFT ||
+#if AUDIO_SFX
+#if AUDIO_ENVELOPE
+const audio_envelope bonk_envelope PROGMEM = { 0, 20, 0, 0, -16, 0, 0 };	// fast decay with pitch drop
+#endif
+const audio_effect bonk_effect PROGMEM =
+{
+	TriTable, 0x0800, 85, 12			// volume fits the mix with two music voices
+#if AUDIO_ENVELOPE
+	, &bonk_envelope
+#endif
+};
 #endif
-		x >= CLIP_RIGHT)
-		{
-			// check if X+width wraps around to be visible on left edge
-			if (
-#if CLIP_LEFT > 0	// avoid warning if CLIP_LEFT 0
-			xw >= CLIP_LEFT &&
-#endif
-			xw < CLIP_RIGHT)
-			{
-				uint8_t cw = xw - CLIP_LEFT;
-				uint8_t skip = ((w - cw) + 7)>>3;
-				x = CLIP_LEFT;
-				w = cw;
-				sdat += (oh * 2) * skip;
-			}
-			else
-			{
-				continue;			// totally clipped
-			}
-		}
-		else if (xw >= CLIP_RIGHT)
-		{
-			w = CLIP_RIGHT - x;
-		}
-		
-		uint8_t tx = x >> 3;				// tile X pos (left edge of sprite)
-		uint8_t sx = x & 0x7;				// sub-tile X pixel (0-7)
-		uint8_t tw = (((uint16_t)w + sx + 7) >> 3);	// width in tiles
 
-		// Y calculations
-		uint8_t y = sinfo->y + v_fine_scroll;		// desired Y position
-		uint8_t h = oh;					// sprite height (starts same as original height)
+// sprite clip regions (sprite_ram region)
+enum
+{
+	REGION_PLAYFIELD,			// scrolling playfield above HUD
+	REGION_HUD,				// HUD rows (not scrolled)
+	REGION_SCREEN				// whole screen (not scrolled)
+};
 
-		uint8_t yh = y + h;
-		if (
-#if CLIP_TOP > 0	// avoid warning if CLIP_TOP 0
-		y < CLIP_TOP || 
-#endif
-		y >= CLIP_BOTTOM)
-		{
-			// check if X+width is visible
-			if (
-#if CLIP_TOP > 0	// avoid warning if CLIP_TOP 0
-			yh >= CLIP_TOP &&
-#endif
-			yh < CLIP_BOTTOM)
-			{
-				uint8_t ch = yh - CLIP_TOP;
-				uint8_t skip = h - ch;
-				y = CLIP_TOP;
-				h = ch;
-				sdat += skip << 1;
-			}
-			else
-			{
-				continue;			// totally clipped
-			}
-		}
-		else if (yh >= CLIP_BOTTOM)
-		{
-			h = CLIP_BOTTOM - y;
-		}
+const sprite_region sprite_regions[] PROGMEM =
+{
+	{ CLIP_LEFT, CLIP_TOP, CLIP_RIGHT, CLIP_BOTTOM, 1 },
+	{ CLIP_LEFT, HUD_TOP, CLIP_RIGHT, V_CHARS*8, 0 },
+	{ CLIP_LEFT, CLIP_TOP, CLIP_RIGHT, V_CHARS*8, 0 }
+};
 
-		uint8_t ty = y >> 3;				// tile Y pos
-		uint8_t sy = y & 0x7;				// sub-tile Y pixel (0-7)
-		uint8_t th = (((uint16_t)h + sy + 7) >> 3);	// height in tiles
-		
-		uint8_t numt = tw * th;
-		
-		if (next_sram_tile + numt >= NUM_RAMTILES)	// out of RAM tiles for sprites?
-		{
-			sinfo->def |= 0x80;			// disable the sprite
-			continue;
-		}
+SpritePool<sprite_def, SPRITE_NUM_IMAGES, MAX_SPRITES, NUM_RAMTILES, MAX_SAVE_TILES, CLIP_LEFT, CLIP_TOP, CLIP_RIGHT, CLIP_BOTTOM, BLANK_TILE,
+	   sprite_metas, SPRITE_NUM_METAS, sprite_regions>	sprites;
 
-		for (x = 0; x != tw; x++)
-		{
-			uint8_t *pos = (((uint8_t *)ScreenMem) + (ty * H_CHARS) + (tx+x));
-			const uint8_t *srom = sdat;
-			sdat += oh * 2;
-
-			uint8_t *tram = 0;
-			uint8_t nt;
-			uint8_t tc = sy;
-			for (y = 0; y < h; y++)
-			{
-				if (tc == 0 || y == 0)
-				{
-					uint8_t ot = *pos;
-					nt = next_sram_tile++;
-					// if room, save old tile (unsaved tiles restored to BLANK_TILE)
-					if (nt < MAX_SAVE_TILES)
-					{
-						save_tiles[nt] = ot;
-					}
-
-					tram = &RAMTiles[nt];
-					// was old character in 
-					if (ot < 0x80)
-					{
-						const uint8_t *rom = (const uint8_t *)((uint16_t)rom_tile_high<<8) + ot;
-						
-						*tram = pgm_read_byte(rom);
-						rom += FONT_CHARS;
-						tram += NUM_RAMTILES;
-						*tram = pgm_read_byte(rom);
-						rom += FONT_CHARS;
-						tram += NUM_RAMTILES;
-						*tram = pgm_read_byte(rom);
-						rom += FONT_CHARS;
-						tram += NUM_RAMTILES;
-						*tram = pgm_read_byte(rom);
-						rom += FONT_CHARS;
-						tram += NUM_RAMTILES;
-						*tram = pgm_read_byte(rom);
-						rom += FONT_CHARS;
-						tram += NUM_RAMTILES;
-						*tram = pgm_read_byte(rom);
-						rom += FONT_CHARS;
-						tram += NUM_RAMTILES;
-						*tram = pgm_read_byte(rom);
-						rom += FONT_CHARS;
-						tram += NUM_RAMTILES;
-						*tram = pgm_read_byte(rom);
-					}
-					else
-					{
-						uint8_t *ram = &RAMTiles[ot&0x7f];
-						
-						*tram = *ram;
-						tram += NUM_RAMTILES;
-						ram += NUM_RAMTILES;
-						*tram = *ram;
-						tram += NUM_RAMTILES;
-						ram += NUM_RAMTILES;
-						*tram = *ram;
-						tram += NUM_RAMTILES;
-						ram += NUM_RAMTILES;
-						*tram = *ram;
-						tram += NUM_RAMTILES;
-						ram += NUM_RAMTILES;
-						*tram = *ram;
-						tram += NUM_RAMTILES;
-						ram += NUM_RAMTILES;
-						*tram = *ram;
-						tram += NUM_RAMTILES;
-						ram += NUM_RAMTILES;
-						*tram = *ram;
-						tram += NUM_RAMTILES;
-						ram += NUM_RAMTILES;
-						*tram = *ram;
-					}
-					*pos = 0x80 | nt;
-					pos += H_CHARS;
-
-					tram = &RAMTiles[nt];
-					if (y == 0)
-						tram += tc*NUM_RAMTILES;
-				}
-				tc = (tc + 1) & 0x7;
-				uint8_t m = pgm_read_byte(srom++);
-				uint8_t b = pgm_read_byte(srom++);
-				*tram = (*tram & m) ^ b;
-				tram += NUM_RAMTILES;
-			}
-		}
-	}
+#if SPRITE_BENCHMARK
+// Cycle position in the current frame (scan line plus timer 1 count, only useful for differences)
+static int32_t frame_cycles()
+{
+	uint8_t sreg = SREG;
+	cli();
+	uint16_t t = TCNT1;
+	uint16_t l = scan_line;
+	if ((TIFR1 & _BV(TOV1)) && t < (uint16_t)(CYCLES_LINE/2))	// overflow interrupt still pending
+		l++;
+	SREG = sreg;
+
+	return ((int32_t)l * (uint16_t)(CYCLES_LINE+1)) + t;
 }
 
-static void clear_sprites()
+uint32_t	bench_cycles;
+uint8_t		bench_frames;
+
+// time sprites.draw() (e.g., to compare pre-shifted vs. runtime shifted sprites from crunch_sprites -r)
+static void bench_draw_sprites()
 {
-	// restore screen (in backwards order)
-	for (int8_t s = MAX_SPRITES-1; s >= 0; s--)
+	int32_t t = frame_cycles();
+	sprites.draw();
+	t = frame_cycles() - t;
+	if (t < 0)					// wrapped into next frame
+		t += (int32_t)LINES_FRAME * (uint16_t)(CYCLES_LINE+1);
+
+	bench_cycles += t;
+	if (++bench_frames == 64)
 	{
-		sprite_ram *sinfo = &sprite_info[s];
-		if (sinfo->def & 0x80)
-		{
-			sinfo->def &= 0x7f;
-			continue;
-		}
+		SerialPrint("sprites.draw cycles=");
+		serial_print_hex_u16(bench_cycles >> 6);
+		SerialPrint("\n");
+		bench_cycles = 0;
+		bench_frames = 0;
+	}
+}
+#endif
 
-		uint8_t def = sinfo->def-1;
-			
-		// skip zero or invalid sprite
-		if (def >= SPRITE_NUM_IMAGES)
-		{
-			continue;
-		}
+#if FRAME_GOVERNOR
+// Frame time governor.  Sprite clear, game and sprite work must finish between END_RENDER and the next
+// START_RENDER, so the time each takes (in scan lines, averaged over recent frames) is used to predict whether
+// this frame's work fits.  If not, non-critical work (the HUD redraw) is deferred and sprites are shed from the
+// highest gov_ranks entry down (never below GOV_MIN_SPRITES).
+uint16_t	gov_clear_lines;		// average sprites.clear() time (scan lines * 16)
+uint16_t	gov_game_lines;			// average screen_state handler time (scan lines * 16)
+uint16_t	gov_sprite_lines;		// average sprites.draw() time per sprite (scan lines * 16)
+uint8_t		gov_defer;			// non-zero to skip non-critical work this frame
+uint8_t		gov_frames;			// frames since stats were printed
+uint8_t		gov_overruns;			// frames missed since stats were printed
+uint8_t		gov_shed;			// frames that skipped a sprite since stats were printed
+uint8_t		gov_deferred;			// frames that deferred work since stats were printed
+
+// shed rank of each sprite (0 to MAX_SPRITES-1, each once, highest shed first): player and HUD fuel bar are kept
+const uint8_t gov_ranks[MAX_SPRITES] PROGMEM = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+static uint16_t gov_scan_line()
+{
+	uint8_t sreg = SREG;
+	cli();
+	uint16_t l = scan_line;
+	SREG = sreg;
 
-		const sprite_rom *sdef = &sprite_def[def];
+	return l;
+}
 
-		// X calculations
-		uint8_t x = sinfo->x;
-		uint8_t w = pgm_read_byte(&sdef->w);
+// scan lines until visible display starts (0 if already displaying)
+static uint16_t gov_lines_left()
+{
+	uint16_t l = gov_scan_line();
+	if (l < START_RENDER)
+		return START_RENDER - l;
+	if (l < END_RENDER || l >= LINES_FRAME)
+		return 0;
+	return (LINES_FRAME - l) + START_RENDER;
+}
 
+// scan lines since l
+static uint16_t gov_lines_since(uint16_t l)
+{
+	uint16_t n = gov_scan_line();
+	if (n < l)					// wrapped into next frame
+		n += LINES_FRAME;
+	return n - l;
+}
 
-		// if X off right or left edge 
-		uint8_t xw = x+w;
-		if (
-#if CLIP_LEFT > 0	// avoid warning if CLIP_LEFT 0
-		x < CLIP_LEFT ||
-#endif
-		x >= CLIP_RIGHT)
-		{
-			// check if X+width wraps around to be visible on left edge
-			if (
-#if CLIP_LEFT > 0	// avoid warning if CLIP_LEFT 0
-			xw >= CLIP_LEFT &&
-#endif
-			xw < CLIP_RIGHT)
-			{
-				x = CLIP_LEFT;
-				w = xw - CLIP_LEFT;
-			}
-			else
-			{
-				continue;			// totally clipped
-			}
-		}
-		else if (xw >= CLIP_RIGHT)			// is it extending off right edge?
-		{
-			w = CLIP_RIGHT - x;
-		}
-		
-		uint8_t tx = x >> 3;				// tile X pos
-		uint8_t sx = x & 0x7;				// sub-tile X pixel (0-7)
-		uint8_t tw = ((uint16_t)w + sx + 7) >> 3;	// width in tiles
+// running average of lines*16 (1/8 new sample)
+static uint16_t gov_average(uint16_t avg, uint16_t lines16)
+{
+	return avg - (avg >> 3) + (lines16 >> 3);
+}
 
-		// Y calculations
-		uint8_t y = sinfo->y + v_fine_scroll;				// desired Y position
-		uint8_t h = pgm_read_byte(&sdef->h);				// sprite height
+// decide if non-critical work should wait for a later frame
+static void gov_start_frame()
+{
+	uint16_t need = gov_clear_lines + gov_game_lines + (GOV_MIN_SPRITES * gov_sprite_lines) + (GOV_MARGIN_LINES * 16);
+	gov_defer = (gov_lines_left() * 16) < need;
+	if (gov_defer)
+		gov_deferred++;
+}
 
-		uint8_t yh = y + h;
-		if (
-#if CLIP_TOP > 0	// avoid warning if CLIP_TOP 0
-		y < CLIP_TOP ||
-#endif
-		y >= CLIP_BOTTOM)
-		{
-			// check if X+width is visible
-			if (
-#if CLIP_TOP > 0	// avoid warning if CLIP_TOP 0
-			yh >= CLIP_TOP &&
-#endif
-			yh < CLIP_BOTTOM)
-			{
-				y = CLIP_TOP;
-				h = yh - CLIP_TOP;
-			}
-			else
-			{
-				continue;			// totally clipped
-			}
-		}
-		else if (yh >= CLIP_BOTTOM)
+// draw as many sprites (by priority) as predicted to fit before START_RENDER
+static void gov_draw_sprites()
+{
+	uint16_t left = gov_lines_left() * 16;
+	uint8_t limit = MAX_SPRITES;
+	if (gov_sprite_lines != 0)
+	{
+		left = left > (GOV_MARGIN_LINES * 16) ? left - (GOV_MARGIN_LINES * 16) : 0;
+		uint16_t n = left / gov_sprite_lines;
+		if (n < MAX_SPRITES)
+			limit = n < GOV_MIN_SPRITES ? GOV_MIN_SPRITES : n;
+	}
+	for (uint8_t s = 0; s < MAX_SPRITES; s++)
+	{
+		if (pgm_read_byte(&gov_ranks[s]) >= limit && sprites.info[s].def)	// only count frames where a sprite is really skipped
 		{
-			h = CLIP_BOTTOM - y;
+			gov_shed++;
+			break;
 		}
+	}
 
-		uint8_t ty = y >> 3;				// sub-tile Y pixel (0-7)
-		uint8_t sy = y & 0x7;				// tile Y pos
-		uint8_t th = ((uint16_t)h + sy + 7) >> 3;	// height in tiles
-
-		uint8_t numt = tw * th;
-
-		next_sram_tile -= numt;
-		uint8_t st = next_sram_tile;
+	uint16_t l = gov_scan_line();
+	uint8_t drawn = sprites.draw(limit, gov_ranks);
+	if (drawn)
+		gov_sprite_lines = gov_average(gov_sprite_lines, (gov_lines_since(l) * 16) / drawn);
 
-		for (x = 0; x != tw; x++)
+	if (++gov_frames == 0)				// every 256 frames
+	{
+		if (gov_overruns | gov_shed | gov_deferred)
 		{
-			uint8_t *pos = (((uint8_t *)ScreenMem) + (ty * H_CHARS) + (tx+x));
-			for (y = 0; y != th; y++)
-			{
-				if (st < MAX_SAVE_TILES)
-					*pos = save_tiles[st];
-				else
-					*pos = BLANK_TILE;
-				st++;
-				pos += H_CHARS;
-			}
+			SerialPrint("gov overruns=");
+			serial_print_hex_u8(gov_overruns);
+			SerialPrint(" shed=");
+			serial_print_hex_u8(gov_shed);
+			SerialPrint(" deferred=");
+			serial_print_hex_u8(gov_deferred);
+			SerialPrint("\n");
 		}
+		gov_overruns = 0;
+		gov_shed = 0;
+		gov_deferred = 0;
 	}
-	
-	next_sram_tile = 0;
 }
+#endif
 
 ////////////////////////////////////////////////
 //
@@ -904,6 +868,10 @@ static void update_stats()
 	if (score > 999999L)
 		score = 999999L;
 
+#if FRAME_GOVERNOR
+	if (gov_defer)					// HUD can wait a frame
+		return;
+#endif
 	draw_HUD();
 }
 
@@ -916,30 +884,63 @@ static void update_vertical_cavern_screen()
 		draw_horizontal_playfield_line(POS(0, 0));
 	}
 
-	sprite_info[0].def = SPRITE_death_star;
+	sprites.info[0].def = SPRITE_death_star;
+#if SPRITE_REGIONS
+	// fuel level marker stays on HUD while playfield scrolls under death star
+	sprites.info[1].def = SPRITE_pixel7;
+	sprites.info[1].region = REGION_HUD;
+	sprites.info[1].x = (3*8) + (fuel > FUEL_MAX ? FUEL_MAX : fuel);
+	sprites.info[1].y = HUD_TOP;
+#endif
 	
 #if BUTTON_LEFT_PIN >= 0
 	if (FastPin<BUTTON_LEFT_PIN>::read() == LOW)
-		sprite_info[0].x--;
+		sprites.info[0].x--;
 #endif
 
 #if BUTTON_RIGHT_PIN >= 0
 	if (FastPin<BUTTON_RIGHT_PIN>::read() == LOW)
-		sprite_info[0].x++;
+		sprites.info[0].x++;
 #endif
 
 #if BUTTON_UP_PIN >= 0
 	if (FastPin<BUTTON_UP_PIN>::read() == LOW)
-		sprite_info[0].y--;
+		sprites.info[0].y--;
 #endif
 
 #if BUTTON_DOWN_PIN >= 0
 	if (FastPin<BUTTON_DOWN_PIN>::read() == LOW)
-		sprite_info[0].y++;
+		sprites.info[0].y++;
+#endif
+
+#if SPRITE_MISSILES
+	// shot flies up until it leaves top of playfield
+	sprite_missile *shot = &sprites.missiles[0];
+	if (shot->h)
+	{
+		shot->y -= 4;
+		if (shot->y >= CLIP_BOTTOM)
+			shot->h = 0;
+	}
 #endif
 
 #if BUTTON_FIRE_PIN >= 0
-//	if (FastPin<BUTTON_FIRE_PIN>::read() == LOW)
+	if (FastPin<BUTTON_FIRE_PIN>::read() == LOW)
+	{
+#if SPRITE_MISSILES
+		if (shot->h == 0)
+		{
+			shot->x = sprites.info[0].x + 4;
+			shot->y = sprites.info[0].y - 6;
+			shot->h = 6;
+			shot->pen = SPRITE_PEN_XOR;
+			memset(shot->lines, 0x18, sizeof (shot->lines));	// 2 pixel wide bolt
+#if AUDIO_SAMPLES
+			audio_sample_play(&zap_sample, 160);
+#endif
+		}
+#endif
+	}
 #endif
 }
 
@@ -955,8 +956,21 @@ static void draw_game_screen()
 {
 	if (screen_timer == 0)
 	{
-		memset(sprite_info, 0, sizeof (sprite_info));
+		memset(sprites.info, 0, sizeof (sprites.info));
+#if SPRITE_MISSILES
+		memset(sprites.missiles, 0, sizeof (sprites.missiles));
+#endif
 		TTVT_SetFont(OSI_font8x8);
+#if SPRITE_PRIORITY
+		sprites.set_priority(OSI_font8x8);	// cavern walls (any set font pixel) hide sprites
+#endif
+#if AUDIO_MUSIC
+		audio_music_stop();
+#endif
+#if AUDIO_NOISE
+		audio_noise.freq = 0x30;		// low engine rumble
+		audio_noise.vol = 0x0f;
+#endif
 		draw_initial_vertical_cavern_screen();
 	}
 	else
@@ -970,39 +984,36 @@ static void draw_BOOT()
 	if (screen_timer == 0)
 	{
 		TTVT_SetFont(Logo_font8x8);
+#if SPRITE_PRIORITY
+		sprites.set_priority(0);
+#endif
 		for (uint16_t c = 0; c < 1024; c++)
 			RAMTiles[c] = pgm_read_byte(hex_font8x8 + c) ^ 0xff;
 		memcpy_P(POS(0,0), LogoTiles, 22*22);
-		sprite_info[0].x = 8;
-		sprite_info[0].y = 8;
-		sprite_info[1].x = 32;
-		sprite_info[1].y = 32;
-		sprite_info[2].x = 64;
-		sprite_info[2].y = 64;
+		sprites.info[0].x = 8;
+		sprites.info[0].y = 8;
 	}
 		
-	sprite_info[0].def = SPRITE_death_star;
-	sprite_info[1].def = SPRITE_square;
-	sprite_info[2].def = SPRITE_XOR_test;
+	sprites.info[0].def = SPRITE_boot_group;	// death star, square and XOR test as one meta-sprite
 	
 #if BUTTON_LEFT_PIN >= 0
 	if (FastPin<BUTTON_LEFT_PIN>::read() == LOW)
-		sprite_info[0].x--, sprite_info[1].x--, sprite_info[2].x--;
+		sprites.info[0].x--;
 #endif
 
 #if BUTTON_RIGHT_PIN >= 0
 	if (FastPin<BUTTON_RIGHT_PIN>::read() == LOW)
-		sprite_info[0].x++, sprite_info[1].x++, sprite_info[2].x++;
+		sprites.info[0].x++;
 #endif
 
 #if BUTTON_UP_PIN >= 0
 	if (FastPin<BUTTON_UP_PIN>::read() == LOW)
-		sprite_info[0].y--, sprite_info[1].y--, sprite_info[2].y--;
+		sprites.info[0].y--;
 #endif
 
 #if BUTTON_DOWN_PIN >= 0
 	if (FastPin<BUTTON_DOWN_PIN>::read() == LOW)
-		sprite_info[0].y++, sprite_info[1].y++, sprite_info[2].y++;
+		sprites.info[0].y++;
 #endif
 
 #if BUTTON_FIRE_PIN >= 0
@@ -1022,8 +1033,20 @@ static void draw_SPRITES()
 {
 	if (screen_timer == 0)
 	{
-		memset(sprite_info, 0, sizeof (sprite_info));
+#if AUDIO_MUSIC
+		audio_music_play(&title_music_song);
+#endif
+#if AUDIO_NOISE
+		audio_noise.vol = 0;
+#endif
+		memset(sprites.info, 0, sizeof (sprites.info));
+#if SPRITE_MISSILES
+		memset(sprites.missiles, 0, sizeof (sprites.missiles));
+#endif
 		TTVT_SetFont(OSI_font8x8);
+#if SPRITE_PRIORITY
+		sprites.set_priority(0);
+#endif
 		for (uint16_t c = 0; c < 1024; c++)
 			RAMTiles[c] = pgm_read_byte(hex_font8x8 + c) ^ 0xff;
 		for (uint8_t v = 0; v < V_CHARS; v++)
@@ -1032,7 +1055,12 @@ static void draw_SPRITES()
 		
 		for (uint8_t s = 1; s < MAX_SPRITES; s++)
 		{
-			sprite_info[s].def = SPRITE_ball_1;
+#if SPRITE_ANIM
+			sprites.info[s].anim = ANIM_all_images;	// cycle through every sprite image
+			sprites.info[s].frame = s;
+#else
+			sprites.info[s].def = SPRITE_ball_1;
+#endif
 		}
 		CursorPos(0, V_CHARS-2);
 		clearto(POS(H_CHARS-1, V_CHARS-1), BLANK_TILE);
@@ -1042,42 +1070,75 @@ static void draw_SPRITES()
 		Print("SPRITE FLICKER NORMAL");
 	}
 
-	sprite_info[0].def = SPRITE_smiley_test;
+	sprites.info[0].def = SPRITE_smiley_test;
+
+#if SPRITE_COLLISION
+	CursorPos(H_CHARS-2, V_CHARS-2);
+	printbyte(sprites.hits[0]);			// balls touched by smiley last frame
+#if AUDIO_SFX
+	static uint8_t last_hits;
+	if (sprites.hits[0] & ~last_hits)		// touched another ball
+		audio_sfx_play(&bonk_effect, 1);
+	last_hits = sprites.hits[0];
+#endif
+#endif
+#if AUDIO_SFX
+	uint8_t smiley_x = sprites.info[0].x;
+	uint8_t smiley_y = sprites.info[0].y;
+#endif
 	
 #if BUTTON_LEFT_PIN >= 0
 	if (FastPin<BUTTON_LEFT_PIN>::read() == LOW)
-		sprite_info[0].x--;
+		sprites.info[0].x--;
 #endif
 
 #if BUTTON_RIGHT_PIN >= 0
 	if (FastPin<BUTTON_RIGHT_PIN>::read() == LOW)
-		sprite_info[0].x++;
+		sprites.info[0].x++;
 #endif
 
 #if BUTTON_UP_PIN >= 0
 	if (FastPin<BUTTON_UP_PIN>::read() == LOW)
-		sprite_info[0].y--;
+		sprites.info[0].y--;
 #endif
 
 #if BUTTON_DOWN_PIN >= 0
 	if (FastPin<BUTTON_DOWN_PIN>::read() == LOW)
-		sprite_info[0].y++;
+		sprites.info[0].y++;
+#endif
+
+#if AUDIO_SFX
+	static uint8_t was_moving;
+	uint8_t moving = sprites.info[0].x != smiley_x || sprites.info[0].y != smiley_y;
+	if (moving && !was_moving)			// smiley started moving
+		audio_sfx_play(&bonk_effect, 1);	// low priority (music resumes on the voice at its next note)
+	was_moving = moving;
 #endif
 
 	for (uint8_t s = 1; s < MAX_SPRITES; s++)
 	{
 		spr_x[s] += s;
-		sprite_info[s].x = (spr_x[s]>>4);
-		uint8_t oy = sprite_info[s].y;
-		sprite_info[s].y = (spr_x[s]/3);
-		if (oy > 0xf0 &&  sprite_info[s].y < 0x10 && sprite_info[s].x > 0x90)
+		sprites.info[s].x = (spr_x[s]>>4);
+#if SPRITE_ANIM
+		sprites.info[s].y = (spr_x[s]/3);
+#else
+		uint8_t oy = sprites.info[s].y;
+		sprites.info[s].y = (spr_x[s]/3);
+		if (oy > 0xf0 &&  sprites.info[s].y < 0x10 && sprites.info[s].x > 0x90)
 		{
-			uint8_t sp = sprite_info[s].def + 1;
+			uint8_t sp = sprites.info[s].def + 1;
 			if (sp > SPRITE_NUM_IMAGES)
 				sp = 1;
-			sprite_info[s].def = sp;
+			sprites.info[s].def = sp;
 		}
+#endif
 	}
+
+#if SPRITE_BITMAP
+	// tether from smiley to first ball (drawn under sprites)
+	sprites.line(sprites.info[0].x + 8, sprites.info[0].y + v_fine_scroll + 8,
+		     sprites.info[1].x + 4, sprites.info[1].y + v_fine_scroll + 4, SPRITE_PEN_XOR);
+#endif
 		
 #if BUTTON_FIRE_PIN >= 0
 	if (FastPin<BUTTON_FIRE_PIN>::read() == LOW)
@@ -1133,9 +1194,18 @@ void setup()
 	{
 		SerialPrint("WARNING: Alignment SRAM waste (up to 255 bytes)\n");
 	}
-  freq0 = 0x0100;
-  freq1 = 0x0380;
-  freq2 = 0x0080;
+	SerialPrint("Audio voices=");
+	serial_print_hex_u8(AUDIO_VOICES);
+	SerialPrint(" mix cycles=");
+	serial_print_hex_u16(AUDIO_MIX_CYCLES);
+	SerialPrint("\n");
+	for (uint8_t v = 0; v < AUDIO_VOICES; v++)
+		audio_voices[v].wave = AUDIO_WAVE(v == 2 ? TriTable : SinTable);
+  audio_voices[0].freq = 0x0100;
+#if AUDIO_VOICES > 2
+  audio_voices[1].freq = 0x0380;
+  audio_voices[2].freq = 0x0080;
+#endif
   left_x = (PIXELS_X/2)-((PIXELS_X/2)/2);
   right_x = (PIXELS_X/2)+((PIXELS_X/2)/2);
   fuel = FUEL_MAX+8;  // topped off
@@ -1144,6 +1214,13 @@ void setup()
 	// setup TVoutGameKit to begin video display
 	TVGTK_Setup();
 	
+#if AUDIO_BENCHMARK
+	SerialPrint("Audio mix measured cycles mulsu=");
+	serial_print_hex_u16(bench_mix<false>());
+	SerialPrint(" shift=");
+	serial_print_hex_u16(bench_mix<true>());
+	SerialPrint("\n");
+#endif
 	for (uint8_t i = 0; i < 8; i++)
 	{
 		uint8_t b = 0;
@@ -1181,6 +1258,12 @@ void setup()
 	TCCR2B=0x01;
 	OCR2A = 0x80;
 	DDR_SND |= _BV(SND_PIN);
+#if AUDIO_TIMER
+	TCCR0A = _BV(WGM01);				// CTC (TVGTK_Setup disabled the Arduino millis interrupt)
+	TCCR0B = _BV(CS01);				// clk/8
+	OCR0A = (AUDIO_TIMER_CYCLES / 8) - 1;
+	TIMSK0 = _BV(OCIE0A);
+#endif
 	
 	SerialPrint("\nSetup has finished\n");
 }
@@ -1213,11 +1296,53 @@ void loop()
 	{
 		uint8_t missed = ((int8_t)(vblank_count & 0xff) - last_vcount);
 		serial_putc(missed > 9 ? '!' : '0' + missed);	// too slow, frames missed!
+#if FRAME_GOVERNOR
+		gov_overruns += missed;
+#endif
 	}
 	FastPin<BLINK_LED_PIN>::hi();			// LED on while working (LED showing busy time)
+#if AUDIO_MUSIC
+	audio_music_frame();				// once a frame (tempo slows if frames are missed)
+#endif
+#if AUDIO_SFX
+	audio_sfx_frame();				// end finished effects (frees voices)
+#endif
+#if AUDIO_ENVELOPE
+	audio_envelope_frame();				// after sequencer (applies its notes and effects)
+#endif
+#if AUDIO_BUFFERED
+	mixaudio_buffer();				// refill samples played during display
+	if (++audio_frames == 0)			// every 256 frames
+	{
+		if (audio_underruns)
+		{
+			SerialPrint("audio underruns=");
+			serial_print_hex_u8(audio_underruns);
+			SerialPrint("\n");
+			audio_underruns = 0;
+		}
+#if AUDIO_JITTER
+		SerialPrint("line latency max=");	// must stay below render output delay (minus handler and setup cycles)
+		serial_print_hex_u16(line_latency);
+		SerialPrint(" output delay=");
+		serial_print_hex_u16(OUTPUT_DELAY);
+		SerialPrint("\n");
+		line_latency = 0;
+#endif
+	}
+#endif
 	last_vcount = (int8_t)(vblank_count & 0xff);		// remember frame (low byte is enough)
 	
-	clear_sprites();
+#if FRAME_GOVERNOR
+	gov_start_frame();				// before clear (its time is part of the frame cost)
+	uint16_t clear_start = gov_scan_line();
+#endif
+	sprites.clear();
+
+#if FRAME_GOVERNOR
+	gov_clear_lines = gov_average(gov_clear_lines, gov_lines_since(clear_start) * 16);
+	uint16_t game_start = gov_scan_line();
+#endif
 	
 	switch (screen_state)
 	{
@@ -1242,16 +1367,28 @@ void loop()
 			screen_state = BOOT_SCREEN;
 		}
 	}
+#if FRAME_GOVERNOR
+	gov_game_lines = gov_average(gov_game_lines, gov_lines_since(game_start) * 16);
+#endif
 
 	FastPin<BLINK_LED_PIN>::lo();		// LED off while waiting
 //	FastPin<BLINK_LED_PIN>::hi();		// LED off while waiting
 	
-	draw_sprites();
+#if SPRITE_ANIM
+	sprites.animate(sprite_anims);
+#endif
+#if SPRITE_BENCHMARK
+	bench_draw_sprites();
+#elif FRAME_GOVERNOR
+	gov_draw_sprites();
+#else
+	sprites.draw();
+#endif
 
 #if 0
 	CursorPos(0, V_CHARS-1);
 	Print("RAM:");
-	printbyte(next_sram_tile);
+	printbyte(sprites.next_sram_tile);
 	Print(" SAVE:");
 	printbyte(next_save_tile);
 #endif
@@ -1265,6 +1402,10 @@ void loop()
 	{
 		screen_timer++;
 	}
+
+#if AUDIO_BUFFERED
+	mixaudio_until_display();			// keep samples topped up until display starts
+#endif
 }
 
 // EOF
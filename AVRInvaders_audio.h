@@ -0,0 +1,1022 @@
+// Wave table voice mixer for TVGTK by Xark
+//
+// Each sample steps every voice through a signed 8-bit wave table in flash and adds them up for OCR2A.
+// The code for each voice comes from one template, so a game only pays (in scanline ISR cycles, or loop()
+// cycles with AUDIO_BUFFERED) for the voices and features it selects with the AUDIO_* defines below
+// (define them before including this file).
+//
+// Include before AVRInvaders.h (from LINE_START_HANDLER) and define the voices after it, e.g.:
+//
+//	audio_voice	audio_voices[AUDIO_VOICES];
+//
+//	audio_voices[0].wave = AUDIO_WAVE(SinTable);
+//	audio_voices[0].freq = 0x0100;		// one wave table byte per sample
+
+#ifndef AVRINVADERS_AUDIO_H
+#define AVRINVADERS_AUDIO_H
+
+#ifndef AUDIO_VOICES
+#define AUDIO_VOICES		3		// (1-8) voices mixed each sample (costs 5 bytes SRAM each, +1 with AUDIO_PHASE24, -1 without AUDIO_VOLUME)
+#endif
+#ifndef AUDIO_VOLUME
+#define AUDIO_VOLUME		1		// (0/1) per voice volume (0 silent to 255 full), otherwise voices are scaled by AUDIO_SHIFT
+#endif
+#ifndef AUDIO_PHASE24
+#define AUDIO_PHASE24		0		// (0/1) 16.8 phase (sample index up to 64K bytes from wave) instead of 8.8 (256 byte wave table)
+#endif
+#ifndef AUDIO_NOISE
+#define AUDIO_NOISE		0		// (0/1) LFSR noise voice mixed after the wave voices (no flash table, costs 5 bytes SRAM)
+#endif
+#ifndef AUDIO_MUSIC
+#define AUDIO_MUSIC		0		// (0/1) pattern sequencer driving the voices once a frame (see audio_music_frame)
+#endif
+#ifndef AUDIO_ENVELOPE
+#define AUDIO_ENVELOPE		0		// (0/1) per voice ADSR volume, pitch slide and vibrato envelopes (see audio_envelope_frame)
+#endif
+#ifndef AUDIO_SAMPLES
+#define AUDIO_SAMPLES		0		// (0/1) one-shot PCM/ADPCM sample voice (decoded in batches outside the ISR, see audio_sample_decode)
+#endif
+#ifndef AUDIO_SFX
+#define AUDIO_SFX		0		// (0/1) sound effect voice allocator with priority and voice stealing (see audio_sfx_play)
+#endif
+#ifndef AUDIO_MULFREE
+#if defined(__AVR__) && !defined(__AVR_HAVE_MUL__)
+#define AUDIO_MULFREE		1		// (0/1) shift-and-add volume (top 4 bits of vol) instead of mulsu (default on cores without MUL, e.g., ATtiny45)
+#else
+#define AUDIO_MULFREE		0		// (0/1) shift-and-add volume (top 4 bits of vol) instead of mulsu (default on cores without MUL, e.g., ATtiny45)
+#endif
+#endif
+#ifndef AUDIO_SHIFT
+#define AUDIO_SHIFT		(AUDIO_VOLUME ? 0 : AUDIO_VOICES > 4 ? 3 : AUDIO_VOICES > 2 ? 2 : AUDIO_VOICES > 1 ? 1 : 0)	// voice sample right shift before mixing
+#endif
+
+#include "video_properties.h"	// scanline timing (one sample each scanline)
+
+#ifndef AUDIO_RATE
+#if TV_MODE == PAL
+#define AUDIO_RATE		(1000000.0 / _PAL_TIME_SCANLINE)	// samples per second
+#else
+#define AUDIO_RATE		(1000000.0 / _NTSC_TIME_SCANLINE)	// samples per second
+#endif
+#endif
+
+// approximate cycles to mix one sample (per voice: phase step, wave fetch, volume, shift and add)
+#define AUDIO_VOLUME_CYCLES(mulfree)	(AUDIO_VOLUME ? ((mulfree) ? 15 : 6) : 0)	// lds vol plus mulsu or shift-and-add
+#define AUDIO_VOICE_CYCLES	((AUDIO_PHASE24 ? 27 : 19) + AUDIO_VOLUME_CYCLES(AUDIO_MULFREE) + AUDIO_SHIFT + 1)
+#define AUDIO_NOISE_CYCLES	25				// worst case (LFSR clocked), 15 otherwise
+#define AUDIO_MIX_CYCLES	((AUDIO_VOICES * AUDIO_VOICE_CYCLES) + (AUDIO_NOISE ? AUDIO_NOISE_CYCLES : 0) + 1)
+
+// wave table to audio_voice.wave (high byte of 256 byte aligned flash address) and back
+#if defined(__AVR__)
+#define AUDIO_WAVE(table)	((uint8_t)((uint16_t)(table) >> 8))
+#define AUDIO_WAVE_TABLE(wave)	((const int8_t *)((uint16_t)(wave) << 8))
+#else
+extern "C" const char __start_audio_flash[];	// host build puts PROGMEM in section audio_flash (see utilities/render_audio.cpp)
+#define AUDIO_WAVE(table)	((uint8_t)(((const char *)(table) - __start_audio_flash) >> 8))
+#define AUDIO_WAVE_TABLE(wave)	((const int8_t *)(__start_audio_flash + ((uint16_t)(wave) << 8)))
+#endif
+
+// voice state (address of phase must be first)
+struct audio_voice
+{
+#if AUDIO_PHASE24
+	uint8_t		frac;			// phase fraction (1/256 sample)
+	uint16_t	index;			// phase sample index from start of wave
+#else
+	uint16_t	pos;			// 8.8 phase (wave index in high byte)
+#endif
+	uint16_t	freq;			// 8.8 phase step each sample
+	uint8_t		wave;			// wave address (high byte only, must be 256 byte aligned)
+#if AUDIO_VOLUME
+	uint8_t		vol;			// volume (0 silent to 255 full)
+#endif
+};
+
+extern "C" audio_voice	audio_voices[AUDIO_VOICES];
+
+#if AUDIO_VOLUME
+// apply top 4 bits of volume with shift-and-add (wave * (vol & 0xf0) / 256, for cores without MUL)
+static inline int8_t audio_volume_shift(int8_t w, uint8_t vol)
+{
+#if defined(__AVR__)
+	int8_t s;
+	__asm__ __volatile__
+	(
+		"		clr	%[s]\n"
+		"		asr	%[w]\n"			// wave/2
+		"		sbrc	%[vol],7\n"
+		"		add	%[s],%[w]\n"
+		"		asr	%[w]\n"			// wave/4
+		"		sbrc	%[vol],6\n"
+		"		add	%[s],%[w]\n"
+		"		asr	%[w]\n"			// wave/8
+		"		sbrc	%[vol],5\n"
+		"		add	%[s],%[w]\n"
+		"		asr	%[w]\n"			// wave/16
+		"		sbrc	%[vol],4\n"
+		"		add	%[s],%[w]\n"
+		: [s] "=&r" (s), [w] "+r" (w)			// outputs
+		: [vol] "r" (vol)				// inputs
+	);
+	return s;
+#else
+	return (int8_t)(((vol & 0x80) ? w >> 1 : 0) + ((vol & 0x40) ? w >> 2 : 0) + ((vol & 0x20) ? w >> 3 : 0) + ((vol & 0x10) ? w >> 4 : 0));
+#endif
+}
+
+// apply volume with mulsu (wave * vol / 256)
+static inline int8_t audio_volume_mul(int8_t w, uint8_t vol)
+{
+#if defined(__AVR_HAVE_MUL__)
+	int8_t s;
+	__asm__ __volatile__
+	(
+		"		mulsu	%[w],%[vol]\n"		// apply volume
+		"		mov	%[s],r1\n"			// keep high of result
+		"		clr	__zero_reg__\n"
+		: [s] "=r" (s)					// outputs
+		: [w] "a" (w), [vol] "a" (vol)			// inputs
+		: "r0"						// registers clobbered
+	);
+	return s;
+#elif defined(__AVR__)
+	return audio_volume_shift(w, vol);		// no MUL on this core
+#else
+	return (int8_t)(((int16_t)w * vol) >> 8);
+#endif
+}
+#endif
+
+// step voice V and return its sample (before AUDIO_SHIFT)
+template <uint8_t V, bool MulFree>
+static inline int8_t audio_voice_sample()
+{
+#if defined(__AVR__)
+	int8_t s;
+	__asm__ __volatile__
+	(
+#if AUDIO_PHASE24
+		"		lds	r18,%[pos]\n"		// phase fraction
+		"		lds	r19,%[freq]\n"
+		"		add	r18,r19\n"			// step fraction
+		"		sts	%[pos],r18\n"
+		"		lds	r30,%[pos]+1\n"		// ZL:ZH = sample index
+		"		lds	r31,%[pos]+2\n"
+		"		lds	r19,%[freq]+1\n"
+		"		adc	r19,r30\n"			// step index (with carry from fraction)
+		"		sts	%[pos]+1,r19\n"
+		"		mov	r20,r31\n"
+		"		adc	r20,__zero_reg__\n"
+		"		sts	%[pos]+2,r20\n"
+		"		lds	r18,%[wave]\n"
+		"		add	r31,r18\n"			// ZH += wave address (high, 256 byte aligned)
+#else
+		"		lds	r30,%[pos]+1\n"		// ZL = wave index
+		"		lds	r31,%[pos]\n"		// phase fraction
+		"		lds	r18,%[freq]\n"
+		"		lds	r19,%[freq]+1\n"
+		"		add	r31,r18\n"			// step fraction
+		"		adc	r19,r30\n"			// step index
+		"		sts	%[pos],r31\n"
+		"		sts	%[pos]+1,r19\n"
+		"		lds	r31,%[wave]\n"		// ZH = wave address (high, 256 byte aligned)
+#endif
+		"		lpm	%[s],Z\n"			// wave byte (signed 8-bits)
+		: [s] "=r" (s)					// outputs
+		: [pos] "i" (&audio_voices[V]),			// inputs (addresses of voice state)
+		  [freq] "i" (&audio_voices[V].freq),
+		  [wave] "i" (&audio_voices[V].wave)
+		: "r18", "r19", "r20", "r30", "r31"		// registers clobbered
+	);
+#else
+	audio_voice *v = &audio_voices[V];
+#if AUDIO_PHASE24
+	int8_t s = (int8_t)pgm_read_byte(AUDIO_WAVE_TABLE(v->wave) + v->index);
+	uint16_t f = (uint16_t)v->frac + (v->freq & 0xff);
+	v->frac = (uint8_t)f;
+	v->index += (v->freq >> 8) + (f >> 8);
+#else
+	int8_t s = (int8_t)pgm_read_byte(AUDIO_WAVE_TABLE(v->wave) + (v->pos >> 8));
+	v->pos += v->freq;
+#endif
+#endif
+#if AUDIO_VOLUME
+	s = MulFree ? audio_volume_shift(s, audio_voices[V].vol) : audio_volume_mul(s, audio_voices[V].vol);
+#endif
+	return s;
+}
+
+#if AUDIO_NOISE
+// noise voice state (a 16-bit Galois LFSR clocked by carry out of phase, so freq 0x80 clocks every other sample)
+struct audio_noise_voice
+{
+	uint8_t			phase;		// phase fraction
+	uint8_t			freq;		// phase step each sample (0 stops noise changing, 0xff clocks nearly every sample)
+	uint16_t		lfsr;		// shift register (never 0)
+	uint8_t			vol;		// mask for LFSR high byte (0x00 silent to 0x7f loudest)
+};
+
+extern "C" audio_noise_voice	audio_noise;
+
+// step noise voice and return its sample (0 to vol)
+static inline int8_t audio_noise_sample()
+{
+#if defined(__AVR__)
+	int8_t s;
+	__asm__ __volatile__
+	(
+		"		lds	r18,%[phase]\n"
+		"		lds	r19,%[freq]\n"
+		"		add	r18,r19\n"			// step phase (carry clocks LFSR)
+		"		sts	%[phase],r18\n"
+		"		lds	r31,%[lfsr]+1\n"
+		"		brcc	1f\n"
+		"		lds	r30,%[lfsr]\n"
+		"		lsr	r31\n"			// shift LFSR right
+		"		ror	r30\n"
+		"		brcc	2f\n"
+		"		ldi	r19,0xb4\n"			// taps 16 14 13 11 (x^16 + x^14 + x^13 + x^11 + 1)
+		"		eor	r31,r19\n"
+		"2:		sts	%[lfsr],r30\n"
+		"		sts	%[lfsr]+1,r31\n"
+		"1:		lds	%[s],%[vol]\n"
+		"		and	%[s],r31\n"			// mask LFSR high byte
+		: [s] "=r" (s)					// outputs
+		: [phase] "i" (&audio_noise.phase),		// inputs (addresses of noise state)
+		  [freq] "i" (&audio_noise.freq),
+		  [lfsr] "i" (&audio_noise.lfsr),
+		  [vol] "i" (&audio_noise.vol)
+		: "r18", "r19", "r30", "r31"			// registers clobbered
+	);
+	return s;
+#else
+	uint16_t p = (uint16_t)audio_noise.phase + audio_noise.freq;
+	audio_noise.phase = (uint8_t)p;
+	if (p >> 8)
+		audio_noise.lfsr = (audio_noise.lfsr >> 1) ^ (-(audio_noise.lfsr & 1u) & 0xB400u);
+	return (int8_t)((audio_noise.lfsr >> 8) & audio_noise.vol);
+#endif
+}
+#endif
+
+// sum of voices 0 to N-1 (plus 128 for unsigned output)
+template <uint8_t N, bool MulFree = AUDIO_MULFREE>
+struct audio_mix
+{
+	static inline uint8_t sum()
+	{
+		return audio_mix<N-1, MulFree>::sum() + (uint8_t)(audio_voice_sample<N-1, MulFree>() >> AUDIO_SHIFT);
+	}
+};
+
+template <bool MulFree>
+struct audio_mix<0, MulFree>
+{
+	static inline uint8_t sum()
+	{
+		return 128;
+	}
+};
+
+// mix one sample of all voices (and advance them)
+static inline uint8_t mixsample(void)
+{
+#if AUDIO_NOISE
+	return audio_mix<AUDIO_VOICES>::sum() + (uint8_t)audio_noise_sample();
+#else
+	return audio_mix<AUDIO_VOICES>::sum();
+#endif
+}
+
+#if AUDIO_SAMPLES
+// One-shot sample voice
+//
+// Plays 8-bit PCM or 4-bit IMA ADPCM (low nibble first, starting from predictor 0 and step index 0) from PROGMEM at
+// one sample per AUDIO_RATE (see utilities/crunch_sample to make one from a WAV file).  Samples are decoded in
+// batches by audio_sample_decode() outside the ISR (e.g., where loop() fills the sample buffer), and added to
+// mixsample() there so the ISR still only plays one byte each line.
+
+enum
+{
+	AUDIO_SAMPLE_PCM8,			// signed 8-bit PCM (one byte per sample)
+	AUDIO_SAMPLE_ADPCM4			// 4-bit IMA ADPCM (two samples per byte)
+};
+
+// sample (PROGMEM)
+struct audio_sample
+{
+	const uint8_t		*data;		// PROGMEM sample data
+	uint16_t		length;		// number of samples
+	uint8_t			format;		// AUDIO_SAMPLE_*
+};
+
+// sample voice state
+struct audio_sample_state
+{
+	const uint8_t		*data;		// PROGMEM next byte
+	uint16_t		left;		// samples left to play (0 when idle)
+	uint8_t			format;		// AUDIO_SAMPLE_*
+	uint8_t			vol;		// volume (0 silent to 255 full)
+	int16_t			pred;		// ADPCM predicted sample (16-bit)
+	uint8_t			index;		// ADPCM step index (0-88)
+	uint8_t			nibble;		// ADPCM high nibble is next
+};
+
+extern "C" audio_sample_state	audio_sample_voice;
+
+static const uint16_t audio_adpcm_steps[89] PROGMEM =
+{
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97,
+	107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+	876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871,
+	5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623,
+	27086, 29794, 32767
+};
+
+static const int8_t audio_adpcm_index[8] PROGMEM =
+{
+	-1, -1, -1, -1, 2, 4, 6, 8
+};
+
+// start playing sample (replaces any sample playing)
+static void audio_sample_play(const audio_sample *smp, uint8_t vol)
+{
+	audio_sample_voice.left = 0;			// idle while changing
+	audio_sample_voice.data = (const uint8_t *)pgm_read_ptr(&smp->data);
+	audio_sample_voice.format = pgm_read_byte(&smp->format);
+	audio_sample_voice.vol = vol;
+	audio_sample_voice.pred = 0;
+	audio_sample_voice.index = 0;
+	audio_sample_voice.nibble = 0;
+	audio_sample_voice.left = pgm_read_word(&smp->length);
+}
+
+// stop sample voice
+static inline void audio_sample_stop()
+{
+	audio_sample_voice.left = 0;
+}
+
+// decode next n samples of sample voice into buf (0 when idle)
+static void audio_sample_decode(int8_t *buf, uint8_t n)
+{
+	audio_sample_state *sv = &audio_sample_voice;
+	uint16_t left = sv->left;
+	const uint8_t *d = sv->data;
+	uint8_t vol = sv->vol;
+	if (left < n)
+	{
+		memset(buf + left, 0, n - left);
+		n = left;
+	}
+	sv->left = left - n;
+	if (!n)
+		return;
+
+	if (sv->format == AUDIO_SAMPLE_PCM8)
+	{
+		do
+		{
+			*buf++ = ((int16_t)(int8_t)pgm_read_byte(d++) * vol) >> 8;
+		} while (--n);
+	}
+	else
+	{
+		int16_t pred = sv->pred;
+		uint8_t index = sv->index;
+		uint8_t hi = sv->nibble;
+		do
+		{
+			uint8_t code = pgm_read_byte(d);
+			if (hi)
+			{
+				code >>= 4;
+				d++;
+			}
+			hi ^= 1;
+			uint16_t step = pgm_read_word(&audio_adpcm_steps[index]);
+			uint16_t diff = step >> 3;
+			if (code & 4)
+				diff += step;
+			if (code & 2)
+				diff += step >> 1;
+			if (code & 1)
+				diff += step >> 2;
+			int32_t p = (code & 8) ? (int32_t)pred - diff : (int32_t)pred + diff;
+			pred = p > 32767 ? 32767 : p < -32768 ? -32768 : (int16_t)p;
+			int8_t i = index + (int8_t)pgm_read_byte(&audio_adpcm_index[code & 7]);
+			index = i < 0 ? 0 : i > 88 ? 88 : i;
+			*buf++ = ((int16_t)(int8_t)(pred >> 8) * vol) >> 8;
+		} while (--n);
+		sv->pred = pred;
+		sv->index = index;
+		sv->nibble = hi;
+	}
+	sv->data = d;
+}
+
+// add decoded sample to mixed sample (clipped, voices may already use the full range)
+static inline uint8_t audio_sample_add(uint8_t mix, int8_t s)
+{
+	int16_t v = mix + s;
+	return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+#endif
+
+#if AUDIO_ENVELOPE
+// Voice envelopes
+//
+// audio_envelope_frame() is called once a frame and makes one pass over the voices, rewriting the vol and freq the
+// mixer already reads (so envelopes add nothing per sample).  Envelopes are PROGMEM tables shared by voices:
+// volume rises by attack each frame to 255, falls by decay to sustain, holds until audio_note_off() then falls by
+// release to 0 (a rate of 0 is instant).  The voice volume is the envelope level scaled by the note volume.
+// Pitch slides by adding slide to the note step each frame, and vibrato adds SinTable * vib_depth/128 stepping
+// vib_rate through SinTable each frame.
+
+extern PROGMEM const int8_t SinTable[] __attribute__ ((aligned(256)));
+
+enum
+{
+	AUDIO_ENV_OFF,				// silent (or no envelope)
+	AUDIO_ENV_ATTACK,
+	AUDIO_ENV_DECAY,
+	AUDIO_ENV_SUSTAIN,
+	AUDIO_ENV_RELEASE
+};
+
+// envelope (PROGMEM)
+struct audio_envelope
+{
+	uint8_t			attack;		// level increase each frame (0 instant)
+	uint8_t			decay;		// level decrease each frame to sustain (0 instant)
+	uint8_t			sustain;	// level held until note off
+	uint8_t			release;	// level decrease each frame after note off (0 instant)
+	int8_t			slide;		// added to note step each frame
+	uint8_t			vib_rate;	// vibrato SinTable step each frame
+	uint8_t			vib_depth;	// vibrato depth (step change at SinTable peak * 128)
+};
+
+// voice envelope state
+struct audio_envelope_state
+{
+	const audio_envelope	*env;		// PROGMEM envelope (0 for none)
+	uint16_t		freq;		// note step (before vibrato)
+	uint8_t			vol;		// note volume
+	uint8_t			level;		// envelope level (0-255)
+	uint8_t			stage;		// AUDIO_ENV_*
+	uint8_t			vib;		// vibrato phase
+};
+
+extern "C" audio_envelope_state	audio_envelopes[AUDIO_VOICES];
+
+// start note on voice v (env 0 for constant volume)
+static void audio_note_on(uint8_t v, uint16_t freq, uint8_t vol, const audio_envelope *env)
+{
+	audio_envelope_state *e = &audio_envelopes[v];
+	e->env = env;
+	e->freq = freq;
+	e->vol = vol;
+	e->vib = 0;
+#if AUDIO_PHASE24
+	audio_voices[v].frac = 0;		// start sample from beginning
+	audio_voices[v].index = 0;
+#endif
+	audio_voices[v].freq = freq;
+	if (env)
+	{
+		e->level = 0;
+		e->stage = AUDIO_ENV_ATTACK;
+#if AUDIO_VOLUME
+		audio_voices[v].vol = 0;		// set by next audio_envelope_frame
+#endif
+	}
+	else
+	{
+		e->level = 255;
+		e->stage = AUDIO_ENV_SUSTAIN;		// freq still updated (for sequencer effects)
+#if AUDIO_VOLUME
+		audio_voices[v].vol = vol;
+#endif
+	}
+}
+
+// release note on voice v (silence now if no envelope)
+static void audio_note_off(uint8_t v)
+{
+	audio_envelope_state *e = &audio_envelopes[v];
+	if (e->env && e->stage != AUDIO_ENV_OFF)
+	{
+		e->stage = AUDIO_ENV_RELEASE;
+		return;
+	}
+	e->stage = AUDIO_ENV_OFF;
+#if AUDIO_VOLUME
+	audio_voices[v].vol = 0;
+#endif
+	audio_voices[v].freq = 0;
+}
+
+// step all voice envelopes (call once a frame)
+static void audio_envelope_frame()
+{
+	for (uint8_t v = 0; v < AUDIO_VOICES; v++)
+	{
+		audio_envelope_state *e = &audio_envelopes[v];
+		const audio_envelope *env = e->env;
+		uint8_t stage = e->stage;
+		if (stage == AUDIO_ENV_OFF)
+			continue;
+		if (!env)
+		{
+			audio_voices[v].freq = e->freq;
+			continue;
+		}
+
+		uint8_t level = e->level;
+		if (stage == AUDIO_ENV_ATTACK)
+		{
+			uint8_t r = pgm_read_byte(&env->attack);
+			if (r == 0 || level >= 255 - r)
+			{
+				level = 255;
+				stage = AUDIO_ENV_DECAY;
+			}
+			else
+				level += r;
+		}
+		else if (stage == AUDIO_ENV_DECAY)
+		{
+			uint8_t r = pgm_read_byte(&env->decay);
+			uint8_t sustain = pgm_read_byte(&env->sustain);
+			if (r == 0 || level <= sustain + r)
+			{
+				level = sustain;
+				stage = AUDIO_ENV_SUSTAIN;
+			}
+			else
+				level -= r;
+		}
+		else if (stage == AUDIO_ENV_RELEASE)
+		{
+			uint8_t r = pgm_read_byte(&env->release);
+			if (r == 0 || level <= r)
+			{
+				level = 0;
+				stage = AUDIO_ENV_OFF;
+			}
+			else
+				level -= r;
+		}
+		e->level = level;
+		e->stage = stage;
+#if AUDIO_VOLUME
+		audio_voices[v].vol = ((uint16_t)level * e->vol) >> 8;
+#endif
+
+		uint16_t freq = e->freq + (int8_t)pgm_read_byte(&env->slide);
+		e->freq = freq;
+		uint8_t depth = pgm_read_byte(&env->vib_depth);
+		if (depth)
+		{
+			e->vib += pgm_read_byte(&env->vib_rate);
+			freq += ((int16_t)(int8_t)pgm_read_byte(&SinTable[e->vib]) * depth) >> 7;
+		}
+		audio_voices[v].freq = freq;
+	}
+}
+#endif
+
+#if AUDIO_SFX
+// Sound effect voice allocator
+//
+// audio_sfx_play() takes a voice for a PROGMEM effect: a free voice if there is one (preferring higher voices, as
+// music uses the low ones), otherwise it steals the lowest priority effect (the oldest if tied) unless that is a
+// higher priority than the new one.  audio_sfx_frame() is called once a frame and makes one pass over the voices,
+// releasing the note when the effect length is up and freeing the voice once it is silent.  Music does not write
+// voices owned by an effect (the tune carries on underneath and resumes on its next note).
+
+// sound effect (PROGMEM)
+struct audio_effect
+{
+	const int8_t		*wave;		// wave table (256 byte aligned)
+	uint16_t		freq;		// 8.8 step
+	uint8_t			vol;		// volume
+	uint8_t			frames;		// length in frames before note off (0 until audio_sfx_stop)
+#if AUDIO_ENVELOPE
+	const audio_envelope	*env;		// PROGMEM envelope (0 for constant volume)
+#endif
+};
+
+// sound effect voice state
+struct audio_sfx_state
+{
+	uint8_t			count;		// effects started (for age)
+	struct
+	{
+		uint8_t		priority;	// 0 when voice is free
+		uint8_t		start;		// count when started
+		uint8_t		frames;		// frames left before note off (0 when releasing or held)
+	} voice[AUDIO_VOICES];
+};
+
+extern "C" audio_sfx_state	audio_sfx;
+
+// release effect voice v (frees it when silent)
+static void audio_sfx_stop(uint8_t v)
+{
+	if (!audio_sfx.voice[v].priority)
+		return;
+	audio_sfx.voice[v].frames = 0;
+#if AUDIO_ENVELOPE
+	audio_note_off(v);
+#else
+	audio_sfx.voice[v].priority = 0;
+#if AUDIO_VOLUME
+	audio_voices[v].vol = 0;
+#endif
+	audio_voices[v].freq = 0;
+#endif
+}
+
+// play effect with priority (1-255), returns voice or 0xff if all voices have higher priority effects
+static uint8_t audio_sfx_play(const audio_effect *fx, uint8_t priority)
+{
+	if (!priority)
+		priority = 1;
+	uint8_t best = 0xff;
+	uint8_t best_priority = priority;
+	uint8_t best_age = 0;
+	for (uint8_t v = AUDIO_VOICES; v-- > 0; )
+	{
+		uint8_t p = audio_sfx.voice[v].priority;
+		uint8_t age = audio_sfx.count - audio_sfx.voice[v].start;
+		if (p < best_priority || (p == best_priority && (best == 0xff || age > best_age)))
+		{
+			best = v;
+			best_priority = p;
+			best_age = age;
+			if (!p)
+				break;				// free voice
+		}
+	}
+	if (best == 0xff)
+		return best;
+
+	audio_sfx.voice[best].priority = priority;
+	audio_sfx.voice[best].start = audio_sfx.count++;
+	audio_sfx.voice[best].frames = pgm_read_byte(&fx->frames);
+	audio_voices[best].wave = AUDIO_WAVE(pgm_read_ptr(&fx->wave));
+#if AUDIO_ENVELOPE
+	audio_note_on(best, pgm_read_word(&fx->freq), pgm_read_byte(&fx->vol), (const audio_envelope *)pgm_read_ptr(&fx->env));
+#else
+#if AUDIO_VOLUME
+	audio_voices[best].vol = pgm_read_byte(&fx->vol);
+#endif
+#if AUDIO_PHASE24
+	audio_voices[best].frac = 0;		// start sample from beginning
+	audio_voices[best].index = 0;
+#endif
+	audio_voices[best].freq = pgm_read_word(&fx->freq);
+#endif
+	return best;
+}
+
+// end effects that are done and free silent voices (call once a frame, before audio_envelope_frame)
+static void audio_sfx_frame()
+{
+	for (uint8_t v = 0; v < AUDIO_VOICES; v++)
+	{
+		if (!audio_sfx.voice[v].priority)
+			continue;
+		if (audio_sfx.voice[v].frames && --audio_sfx.voice[v].frames == 0)
+			audio_sfx_stop(v);
+#if AUDIO_ENVELOPE
+		if (audio_envelopes[v].stage == AUDIO_ENV_OFF)
+			audio_sfx.voice[v].priority = 0;
+#endif
+	}
+}
+#endif
+
+#if AUDIO_MUSIC
+// Music sequencer
+//
+// A song is an order list of patterns (all PROGMEM, see utilities/crunch_music to make one from text).  Each pattern
+// row has one slot per song voice, each slot is optional prefix bytes then one note byte:
+//
+//	0x00		empty slot (voice keeps playing)
+//	0x01-0x5f	note (1 = C0, 12 per octave) using current instrument (clears effect)
+//	0x60		note off
+//	0x80-0x9f	prefix: set voice instrument (0-31)
+//	0xa0-0xbf	prefix: effect (AUDIO_FX_*) followed by parameter byte (lasts until next note)
+//	0xc0-0xfe	1 to 63 empty slots (can span rows, replaces note byte)
+//	0xff		end of pattern (next order, must be at start of a row with no skip pending)
+//
+// audio_music_frame() is called once a frame and reads at most one row (a few bytes per voice), so its cost is
+// bounded by the song voices (and effects only cost a table lookup per voice each frame).
+
+enum
+{
+	AUDIO_SEQ_NOTE_OFF	= 0x60,
+	AUDIO_SEQ_INSTRUMENT	= 0x80,
+	AUDIO_SEQ_EFFECT	= 0xa0,
+	AUDIO_SEQ_SKIP		= 0xc0,
+	AUDIO_SEQ_END		= 0xff,
+	AUDIO_SEQ_LOOP		= 0xfe		// order list: restart from first order (0xff stops)
+};
+
+enum
+{
+	AUDIO_FX_NONE		= 0,		// no effect
+	AUDIO_FX_ARPEGGIO	= 1,		// cycle note, note + param>>4, note + (param&0xf) semitones each frame
+	AUDIO_FX_SLIDE		= 2,		// add signed param to step each frame
+	AUDIO_FX_VOLUME		= 3,		// set volume
+	AUDIO_FX_SPEED		= 4		// set frames per row
+};
+
+// music instrument (PROGMEM)
+struct audio_instrument
+{
+	const int8_t		*wave;		// wave table (256 byte aligned)
+	uint8_t			vol;		// note on volume
+#if AUDIO_ENVELOPE
+	const audio_envelope	*env;		// PROGMEM envelope (0 for constant volume)
+#endif
+};
+
+// music song (PROGMEM)
+struct audio_song
+{
+	const uint8_t * const	*patterns;	// PROGMEM pointers to PROGMEM pattern data
+	const uint8_t		*orders;	// pattern numbers ending with AUDIO_SEQ_LOOP or AUDIO_SEQ_END
+	const audio_instrument	*instruments;
+	uint8_t			voices;		// slots per row (voices past AUDIO_VOICES are skipped)
+	uint8_t			speed;		// frames per row
+};
+
+// music sequencer state
+struct audio_music_state
+{
+	const audio_song	*song;		// PROGMEM song playing (0 when stopped)
+	const uint8_t		*data;		// PROGMEM pattern position
+	uint8_t			order;		// position in order list (patterns end with AUDIO_SEQ_END)
+	uint8_t			speed;		// frames per row
+	uint8_t			tick;		// frames left in row
+	uint8_t			skip;		// empty slots left to skip
+	uint8_t			arp;		// arpeggio frame (0-2)
+	struct
+	{
+		uint8_t		note;		// current note
+		uint8_t		instrument;	// current instrument
+		uint8_t		fx;		// current effect
+		uint8_t		param;		// effect parameter
+	} voice[AUDIO_VOICES];
+};
+
+extern "C" audio_music_state	audio_music;
+
+// 8.8 steps for top octave (octave 7) at AUDIO_RATE
+static const uint16_t audio_note_steps[12] PROGMEM =
+{
+	(uint16_t)(2093.00 * 65536.0 / AUDIO_RATE + 0.5),	// C7
+	(uint16_t)(2217.46 * 65536.0 / AUDIO_RATE + 0.5),
+	(uint16_t)(2349.32 * 65536.0 / AUDIO_RATE + 0.5),
+	(uint16_t)(2489.02 * 65536.0 / AUDIO_RATE + 0.5),
+	(uint16_t)(2637.02 * 65536.0 / AUDIO_RATE + 0.5),
+	(uint16_t)(2793.83 * 65536.0 / AUDIO_RATE + 0.5),
+	(uint16_t)(2959.96 * 65536.0 / AUDIO_RATE + 0.5),
+	(uint16_t)(3135.96 * 65536.0 / AUDIO_RATE + 0.5),
+	(uint16_t)(3322.44 * 65536.0 / AUDIO_RATE + 0.5),
+	(uint16_t)(3520.00 * 65536.0 / AUDIO_RATE + 0.5),	// A7
+	(uint16_t)(3729.31 * 65536.0 / AUDIO_RATE + 0.5),
+	(uint16_t)(3951.07 * 65536.0 / AUDIO_RATE + 0.5)	// B7
+};
+
+// 8.8 step for note (1 = C0)
+static uint16_t audio_note_step(uint8_t note)
+{
+	uint8_t shift = 7;
+	note--;
+	while (note >= 12)
+	{
+		note -= 12;
+		shift--;
+	}
+	return pgm_read_word(&audio_note_steps[note]) >> shift;
+}
+
+// PROGMEM pattern data for order (0 if end of song)
+static const uint8_t *audio_music_pattern(uint8_t order)
+{
+	const audio_song *song = audio_music.song;
+	const uint8_t *orders = (const uint8_t *)pgm_read_ptr(&song->orders);
+	uint8_t p = pgm_read_byte(&orders[order]);
+	if (p == AUDIO_SEQ_LOOP)
+	{
+		audio_music.order = 0;
+		p = pgm_read_byte(&orders[0]);
+	}
+	if (p == AUDIO_SEQ_END)
+		return 0;
+	const uint8_t * const *patterns = (const uint8_t * const *)pgm_read_ptr(&song->patterns);
+	return (const uint8_t *)pgm_read_ptr(&patterns[p]);
+}
+
+// stop song and silence voices
+static void audio_music_stop()
+{
+	audio_music.song = 0;
+	for (uint8_t v = 0; v < AUDIO_VOICES; v++)
+	{
+#if AUDIO_SFX
+		if (audio_sfx.voice[v].priority)
+			continue;			// effect playing
+#endif
+#if AUDIO_ENVELOPE
+		audio_envelopes[v].stage = AUDIO_ENV_OFF;
+#endif
+#if AUDIO_VOLUME
+		audio_voices[v].vol = 0;
+#endif
+		audio_voices[v].freq = 0;
+	}
+}
+
+// start playing song from first order
+static void audio_music_play(const audio_song *song)
+{
+	audio_music_stop();
+	memset(&audio_music, 0, sizeof (audio_music));
+	audio_music.song = song;
+	audio_music.data = audio_music_pattern(0);
+	audio_music.speed = pgm_read_byte(&song->speed);
+	if (!audio_music.data)
+		audio_music.song = 0;
+}
+
+// read one pattern row
+static void audio_music_row()
+{
+	const audio_song *song = audio_music.song;
+	const uint8_t *d = audio_music.data;
+	if (!audio_music.skip && pgm_read_byte(d) == AUDIO_SEQ_END)	// end of pattern (only at start of row)
+	{
+		d = audio_music_pattern(++audio_music.order);
+		if (!d)
+		{
+			audio_music_stop();
+			return;
+		}
+	}
+	const audio_instrument *instruments = (const audio_instrument *)pgm_read_ptr(&song->instruments);
+	uint8_t voices = pgm_read_byte(&song->voices);
+	for (uint8_t v = 0; v < voices; v++)
+	{
+		if (audio_music.skip)
+		{
+			audio_music.skip--;
+			continue;
+		}
+		uint8_t b = pgm_read_byte(d++);
+		uint8_t ins = 0xff;
+		uint8_t fx = AUDIO_FX_NONE;
+		uint8_t param = 0;
+		if ((b & 0xe0) == AUDIO_SEQ_INSTRUMENT)
+		{
+			ins = b & 0x1f;
+			b = pgm_read_byte(d++);
+		}
+		if ((b & 0xe0) == AUDIO_SEQ_EFFECT)
+		{
+			fx = b & 0x1f;
+			param = pgm_read_byte(d++);
+			b = pgm_read_byte(d++);
+		}
+		if (b == AUDIO_SEQ_END)			// malformed, rest of row is empty
+		{
+			d--;
+			break;
+		}
+		if (b >= AUDIO_SEQ_SKIP)
+		{
+			audio_music.skip = b - AUDIO_SEQ_SKIP;	// this slot and (b - AUDIO_SEQ_SKIP) more
+			continue;
+		}
+		if (fx == AUDIO_FX_SPEED)		// global, kept for voices not played or owned by an effect
+		{
+			audio_music.speed = param;
+			fx = AUDIO_FX_NONE;
+		}
+		if (v >= AUDIO_VOICES)
+			continue;
+
+		if (ins != 0xff)
+			audio_music.voice[v].instrument = ins;
+#if AUDIO_SFX
+		if (audio_sfx.voice[v].priority)
+			continue;			// effect playing
+#endif
+		if (b == AUDIO_SEQ_NOTE_OFF)
+		{
+			audio_music.voice[v].fx = AUDIO_FX_NONE;
+#if AUDIO_ENVELOPE
+			audio_note_off(v);			// release
+#else
+#if AUDIO_VOLUME
+			audio_voices[v].vol = 0;
+#endif
+			audio_voices[v].freq = 0;
+#endif
+		}
+		else if (b)
+		{
+			const audio_instrument *ip = &instruments[audio_music.voice[v].instrument];
+			audio_music.voice[v].note = b;
+			audio_music.voice[v].fx = AUDIO_FX_NONE;
+			audio_voices[v].wave = AUDIO_WAVE(pgm_read_ptr(&ip->wave));
+#if AUDIO_ENVELOPE
+			audio_note_on(v, audio_note_step(b), pgm_read_byte(&ip->vol), (const audio_envelope *)pgm_read_ptr(&ip->env));
+#else
+#if AUDIO_VOLUME
+			audio_voices[v].vol = pgm_read_byte(&ip->vol);
+#endif
+#if AUDIO_PHASE24
+			audio_voices[v].frac = 0;	// start sample from beginning
+			audio_voices[v].index = 0;
+#endif
+			audio_voices[v].freq = audio_note_step(b);
+#endif
+		}
+		if (fx == AUDIO_FX_VOLUME)
+		{
+#if AUDIO_ENVELOPE
+			audio_envelopes[v].vol = param;		// scaled by envelope level
+#if AUDIO_VOLUME
+			if (!audio_envelopes[v].env)
+				audio_voices[v].vol = param;
+#endif
+#elif AUDIO_VOLUME
+			audio_voices[v].vol = param;
+#endif
+		}
+		else if (fx != AUDIO_FX_NONE)
+		{
+			audio_music.voice[v].fx = fx;
+			audio_music.voice[v].param = param;
+		}
+	}
+	audio_music.data = d;
+}
+
+// advance music one frame (call once a frame)
+static void audio_music_frame()
+{
+	if (!audio_music.song)
+		return;
+
+	if (audio_music.tick == 0)
+	{
+		audio_music_row();
+		if (!audio_music.song)
+			return;
+		audio_music.tick = audio_music.speed;	// after row (may set speed)
+	}
+	if (audio_music.tick)
+		audio_music.tick--;
+
+	if (++audio_music.arp == 3)
+		audio_music.arp = 0;
+	for (uint8_t v = 0; v < AUDIO_VOICES; v++)
+	{
+#if AUDIO_ENVELOPE
+		uint16_t *freq = &audio_envelopes[v].freq;	// envelope adds vibrato and writes voice
+#else
+		uint16_t *freq = &audio_voices[v].freq;
+#endif
+		uint8_t param = audio_music.voice[v].param;
+#if AUDIO_SFX
+		if (audio_sfx.voice[v].priority)
+			continue;
+#endif
+		switch (audio_music.voice[v].fx)
+		{
+			case AUDIO_FX_ARPEGGIO:
+			{
+				uint8_t n = audio_music.voice[v].note;
+				if (audio_music.arp == 1)
+					n += param >> 4;
+				else if (audio_music.arp == 2)
+					n += param & 0xf;
+				if (n < AUDIO_SEQ_NOTE_OFF)
+					*freq = audio_note_step(n);
+				break;
+			}
+			case AUDIO_FX_SLIDE:
+				*freq += (int8_t)param;
+				break;
+		}
+	}
+}
+#endif
+
+#endif // AVRINVADERS_AUDIO_H
@@ -0,0 +1,1282 @@
+// Pseudo-sprite engine for TVGTK tiled rendering by Xark
+//
+// Sprites are composited each frame into dynamically allocated SRAM characters (RAM tiles)
+// placed over the screen, then removed again before the next frame is drawn.
+//
+// Include after AVRInvaders.h.  Optional features are selected with the SPRITE_* defines
+// below (define them before including this file), sizes and clip rectangle are
+// template parameters of SpritePool so each game only pays for the SRAM it uses, e.g.:
+//
+//	SpritePool<sprite_def, SPRITE_NUM_IMAGES, 8>	sprites;	// 8 sprites from crunch_sprites table
+//
+//	sprites.info[0].def = SPRITE_ball_1;
+//	sprites.draw();			// after frame is displayed...
+//	sprites.clear();		// ...before changing screen or sprites
+
+#ifndef AVRINVADERS_SPRITES_H
+#define AVRINVADERS_SPRITES_H
+
+#ifndef SPRITE_BG_LAYER
+#define SPRITE_BG_LAYER		(RAMEND > 0x8FF)	// (0/1) restore sprite cells from a background tilemap instead of save_tiles (costs H_CHARS*V_CHARS bytes SRAM)
+#endif
+#ifndef SPRITE_COLLISION
+#define SPRITE_COLLISION	0		// (0=off) RAM tiles (from tile 0) tracked for pixel collisions while compositing, e.g. 16 (costs 9*SPRITE_COLLISION+NumSprites+9 bytes SRAM, +SPRITE_COLLISION with meta-sprites)
+#endif
+#ifndef SPRITE_SORT
+#define SPRITE_SORT		0		// (0/1) draw sprites in Y order, lower sprites on top (costs NumSprites bytes SRAM)
+#endif
+#ifndef SPRITE_ROW_TILES
+#define SPRITE_ROW_TILES	0		// (0=off) max sprite RAM tiles per tile row, sprites over it are disabled (costs V_CHARS bytes SRAM)
+#endif
+#ifndef SPRITE_ANIM
+#define SPRITE_ANIM		0		// (0/1) animate() steps sprites through crunch_sprites -a animations (costs 3*NumSprites bytes SRAM)
+#endif
+#ifndef SPRITE_PRIORITY
+#define SPRITE_PRIORITY		0		// (0/1) background pixels set in set_priority() mask table hide sprites (costs 1 byte SRAM)
+#endif
+#ifndef SPRITE_BITMAP
+#define SPRITE_BITMAP		0		// (0/1) plot(), line() etc. draw pixels into RAM tiles taken on first touch of a cell (costs 4 bytes SRAM)
+#endif
+#ifndef SPRITE_MISSILES
+#define SPRITE_MISSILES		0		// (0=off) missiles (up to 8x8 pixel bullets from SRAM line bytes) drawn after sprites (costs 12*SPRITE_MISSILES+4 bytes SRAM)
+#endif
+#ifndef SPRITE_REGIONS
+#define SPRITE_REGIONS		0		// (0/1) clip each sprite to its own sprite_region from the Regions table (costs NumSprites+5 bytes SRAM)
+#endif
+
+// dynamically changing sprite info (in SRAM)
+struct sprite_ram
+{
+	uint8_t		def;
+	uint8_t		x, y;			// x, y pixel position of upper left corner of sprite
+#if SPRITE_ANIM
+	uint8_t		anim;			// animation setting def (1 based ANIM_ from crunch_sprites, 0 for none)
+	uint8_t		frame;			// current animation frame (bit 7 set while ping-pong runs backwards)
+	uint8_t		timer;			// frames left to show current animation frame (0 to start at frame)
+#endif
+#if SPRITE_REGIONS
+	uint8_t		region;			// index of clip region in Regions table (0 for first)
+#endif
+};
+
+// unchanging sprite info (in flash ROM)
+struct sprite_rom
+{
+	int8_t		w, h;
+	const uint8_t	*image[8];		// pre-shifted images (1-7 zero if shifted at runtime from image[0])
+	const uint8_t	*span[8];		// opaque and visible row runs (first, end) of each column for each shift
+};
+
+// sprite animation (in flash ROM, sprite_anims from crunch_sprites -a)
+enum
+{
+	SPRITE_ANIM_LOOP,			// repeat from first frame
+	SPRITE_ANIM_ONCE,			// stop on last frame (anim set to 0)
+	SPRITE_ANIM_PINGPONG			// run forwards then backwards
+};
+
+struct sprite_anim
+{
+	const uint8_t	*frames;		// SPRITE_ def and frames to show it for each animation frame
+	uint8_t		count;			// number of animation frames
+	uint8_t		mode;			// SPRITE_ANIM_LOOP, SPRITE_ANIM_ONCE or SPRITE_ANIM_PINGPONG
+};
+
+// meta-sprite made of several sprite images drawn as one sprite (in flash ROM, sprite_metas from crunch_sprites -m)
+struct sprite_part
+{
+	uint8_t		def;			// SPRITE_ image
+	uint8_t		dx, dy;			// offset from meta-sprite x, y
+};
+
+struct sprite_meta
+{
+	const sprite_part *parts;
+	uint8_t		count;			// number of parts
+	uint8_t		w, h;			// size of all parts
+};
+
+// soft bitmap and missile pen (SPRITE_BITMAP, SPRITE_MISSILES)
+enum
+{
+	SPRITE_PEN_CLEAR,			// clear pixels
+	SPRITE_PEN_SET,				// set pixels
+	SPRITE_PEN_XOR				// invert pixels
+};
+
+// small sprite drawn from SRAM pixel bytes, without flash reads or span tables (SPRITE_MISSILES)
+struct sprite_missile
+{
+	uint8_t		x, y;			// x, y pixel position of upper left corner (like sprite_ram)
+	uint8_t		h;			// lines high (0 for off, up to 8)
+	uint8_t		pen;			// SPRITE_PEN_SET, SPRITE_PEN_XOR or SPRITE_PEN_CLEAR
+	uint8_t		lines[8];		// pixels of each line (leftmost pixel in same bit as font)
+};
+
+// clip rectangle for sprites (in flash ROM, Regions table selected by sprite_ram region)
+struct sprite_region
+{
+	uint8_t		left, top;		// first visible pixel
+	uint8_t		right, bottom;		// pixel past visible rectangle
+	uint8_t		scroll;			// 1 to move with v_fine_scroll (scrolled playfield), 0 to stay on tiles (HUD)
+};
+
+// screen cells covered by each sprite, cached by draw() for clear()
+struct sprite_cells
+{
+	uint8_t		*pos;			// top left screen cell (0 if not drawn)
+	uint8_t		tw, th;			// cells wide and high
+};
+
+#if SPRITE_PRIORITY
+static const uint8_t sprite_no_priority PROGMEM = 0;	// mask line of cells with no priority tile
+#endif
+#if SPRITE_COLLISION
+static const uint8_t sprite_no_cover = 0;		// coverage line of cells with no earlier sprite tile (SRAM)
+#endif
+
+// Merge two adjacent sprite bytes shifted right by s pixels, using the hardware multiplier as a barrel shifter.
+// With f = 1<<(8-s) the high byte of cur*f is cur>>s and the low byte of prev*f is prev<<(8-s).
+static inline uint8_t shift_merge(uint8_t cur, uint8_t prev, uint8_t f)
+{
+	return (uint8_t)(((uint16_t)cur * f) >> 8) | (uint8_t)((uint16_t)prev * f);
+}
+
+// Convert a span row to a row of the clipped sprite (0 to h)
+static inline uint8_t span_row(uint8_t r, uint8_t yskip, uint8_t h)
+{
+	r = r > yskip ? r - yskip : 0;
+	return r > h ? h : r;
+}
+
+// Pixels n to 7 of a tile line byte (leftmost pixel is bit 7, or bit 0 with VIDEO_LITTLE_ENDIAN)
+static inline uint8_t pixels_from(uint8_t n)
+{
+#if VIDEO_LITTLE_ENDIAN
+	return (uint8_t)(0xff << n);
+#else
+	return (uint8_t)(0xff >> n);
+#endif
+}
+
+// Defs/NumDefs	sprite_rom table in flash and number of entries (sprite_def/SPRITE_NUM_IMAGES from crunch_sprites)
+// NumSprites	sprites in pool
+// NumTiles	RAM tiles available to sprites (from RAM tile 0 up)
+// SaveTiles	RAM tiles whose screen cell is saved (others restore to BlankTile, unused with SPRITE_BG_LAYER)
+// Clip*	visible pixel rectangle (ClipBottom moves down with v_fine_scroll, only used by missiles with SPRITE_REGIONS)
+// Metas/NumMetas	sprite_meta table in flash (sprite_metas/SPRITE_NUM_METAS from crunch_sprites, def NumDefs+1 is first)
+// Regions	sprite_region table in flash (with SPRITE_REGIONS, indexed by each sprite's region)
+template <const sprite_rom *Defs, uint8_t NumDefs, uint8_t NumSprites = 8, uint8_t NumTiles = NUM_RAMTILES, uint8_t SaveTiles = 96,
+	  uint8_t ClipLeft = 0, uint8_t ClipTop = 0, uint8_t ClipRight = (H_CHARS-1)*8, uint8_t ClipBottom = (V_CHARS-3)*8, uint8_t BlankTile = 0,
+	  const sprite_meta *Metas = nullptr, uint8_t NumMetas = 0, const sprite_region *Regions = nullptr>
+class SpritePool
+{
+	static_assert(NumTiles <= NUM_RAMTILES, "SpritePool NumTiles exceeds NUM_RAMTILES");
+	static_assert(!SPRITE_COLLISION || NumSprites <= 8, "SPRITE_COLLISION supports at most 8 sprites (one bit per sprite)");
+	static_assert(!SPRITE_COLLISION || SPRITE_MISSILES <= 8, "SPRITE_COLLISION supports at most 8 missiles (one bit per missile)");
+	static_assert(!SPRITE_REGIONS || Regions != nullptr, "SPRITE_REGIONS needs a Regions table");
+	static_assert(!SPRITE_COLLISION || RAMEND > 0x8FF || SPRITE_COLLISION <= 32, "SPRITE_COLLISION over 32 tiles does not fit beside RAMTiles in 2KB SRAM");
+	enum { CoverTiles = SPRITE_COLLISION < NumTiles ? SPRITE_COLLISION : NumTiles };	// RAM tiles tracked for collisions
+
+public:
+	sprite_ram	info[NumSprites];
+	uint8_t		next_sram_tile;			// RAM tiles used by sprites this frame
+
+#if SPRITE_COLLISION
+	// Collision results from the last draw().  A sprite's black, white or XOR pixels hit the earlier sprites in a
+	// cell if they cover any of their black, white or XOR pixels (all earlier sprites in the cell are reported), and
+	// hit the background if they land on set background pixels not covered by an earlier sprite.  Only the first
+	// SPRITE_COLLISION RAM tiles keep coverage, pixels of earlier sprites in later tiles count as background (sprites
+	// drawn first, i.e. lowest indices, take the first tiles).
+	uint8_t		hits[NumSprites];		// bit n set if sprite hit sprite n (reported both ways)
+	uint8_t		bg_hits;			// bit n set if sprite n hit background pixels
+#endif
+#if SPRITE_MISSILES
+	sprite_missile	missiles[SPRITE_MISSILES];	// drawn over sprites by draw()
+#if SPRITE_COLLISION
+	uint8_t		missile_hits[SPRITE_MISSILES];	// bit n set if missile crossed pixels of sprite n in last draw()
+	uint8_t		missile_bg_hits;		// bit n set if missile n hit background pixels
+#endif
+#endif
+#if SPRITE_PRIORITY
+	uint8_t		priority_high;			// priority mask table address (high byte only, 0 for none)
+
+	// Set priority mask table for current ROM font (laid out like font, e.g. <name>_priority8x8 from crunch_tileset -s <BMP>),
+	// set bits are background pixels drawn in front of sprites.  Sprites over RAM tiles are never hidden.
+	void set_priority(const uint8_t *masks)
+	{
+		priority_high = (uint8_t)((uint16_t)masks>>8);
+	}
+#endif
+
+	// draw sprites (those ranked limit and up are shed, i.e. disabled like sprites out of RAM tiles), ranks is a
+	// PROGMEM table of NumSprites shed ranks (0 shed last) or 0 to rank by index, returns number of sprites drawn
+	uint8_t draw(uint8_t limit = NumSprites, const uint8_t *ranks = 0)
+	{
+		uint8_t drawn = 0;
+#if SPRITE_COLLISION
+		memset(hits, 0, sizeof (hits));
+		bg_hits = 0;
+#endif
+#if SPRITE_SORT
+		sort();
+#endif
+#if SPRITE_ROW_TILES
+		memset(row_tiles, 0, sizeof (row_tiles));
+		uint8_t rowt[V_CHARS];				// tiles in each tile row used by sprite
+#else
+		uint8_t *rowt = 0;
+#endif
+		// draw screen
+		for (uint8_t n = 0; n < NumSprites; n++)
+		{
+			uint8_t s = order_at(n);
+			sprite_ram *sinfo = &info[s];
+			sprite_cells *cells = &place[s];
+			cells->pos = 0;
+#if SPRITE_ROW_TILES
+			memset(rowt, 0, sizeof (rowt));
+#endif
+			if ((ranks ? pgm_read_byte(&ranks[s]) : s) >= limit)
+			{
+				if (sinfo->def)
+					sinfo->def |= 0x80;		// disable the sprite (lower priority than limit)
+				continue;
+			}
+			sprite_clip clip;
+			uint8_t def = sinfo->def-1;
+#if SPRITE_REGIONS
+			if (def < NumDefs + NumMetas)
+				memcpy_P(&rgn, &Regions[sinfo->region], sizeof (rgn));
+#endif
+			if (def < NumDefs)
+			{
+				if (!clip_image(&clip, def, sinfo->x, sinfo->y))
+				{
+					continue;			// totally clipped
+				}
+				if (!alloc_tiles(count_tiles(&clip, rowt), rowt))
+				{
+					sinfo->def |= 0x80;		// disable the sprite
+					continue;
+				}
+
+				cells->pos = ((uint8_t *)ScreenMem) + (clip.ty * H_CHARS) + clip.tx;
+				cells->tw = clip.tw;
+				cells->th = clip.th;
+				draw_image(&clip, s, next_sram_tile);
+				drawn++;
+			}
+			else if (NumMetas && (uint8_t)(def - NumDefs) < NumMetas)
+			{
+				const sprite_meta *mdef = &Metas[def - NumDefs];
+				// reject whole group if totally clipped (parts still clip their own edges)
+				if (!visible(sinfo->x, pgm_read_byte(&mdef->w), clip_x0(), clip_x1()) ||
+				    !visible(sinfo->y + clip_scroll(), pgm_read_byte(&mdef->h), clip_y0(), clip_y1() + clip_scroll()))
+				{
+					continue;
+				}
+				const sprite_part *part = (const sprite_part *)pgm_read_word(&mdef->parts);
+				uint8_t count = pgm_read_byte(&mdef->count);
+
+				// count tiles of all parts first, so group is drawn whole or not at all
+				uint8_t numt = 0;
+				for (uint8_t p = 0; p != count; p++)
+				{
+					if (clip_image(&clip, pgm_read_byte(&part[p].def)-1, sinfo->x + pgm_read_byte(&part[p].dx), sinfo->y + pgm_read_byte(&part[p].dy)))
+						numt += count_tiles(&clip, rowt);
+				}
+				if (!alloc_tiles(numt, rowt))
+				{
+					sinfo->def |= 0x80;		// disable the sprite
+					continue;
+				}
+
+				// draw parts into one run of RAM tiles, sharing tiles where parts overlap
+				uint8_t group = next_sram_tile;
+				uint8_t x0 = H_CHARS, y0 = V_CHARS, x1 = 0, y1 = 0;	// cells covered by group
+				for (uint8_t p = 0; p != count; p++)
+				{
+					if (!clip_image(&clip, pgm_read_byte(&part[p].def)-1, sinfo->x + pgm_read_byte(&part[p].dx), sinfo->y + pgm_read_byte(&part[p].dy)))
+						continue;
+					draw_image(&clip, s, group);
+					if (clip.tx < x0)
+						x0 = clip.tx;
+					if (clip.ty < y0)
+						y0 = clip.ty;
+					if (clip.tx + clip.tw > x1)
+						x1 = clip.tx + clip.tw;
+					if (clip.ty + clip.th > y1)
+						y1 = clip.ty + clip.th;
+				}
+				if (x1 != 0)
+				{
+					cells->pos = ((uint8_t *)ScreenMem) + (y0 * H_CHARS) + x0;
+					cells->tw = x1 - x0;
+					cells->th = y1 - y0;
+				}
+				drawn++;
+			}
+		}
+
+#if SPRITE_MISSILES
+		draw_missiles();
+#endif
+
+		return drawn;
+	}
+
+#if SPRITE_ANIM
+	// advance animated sprites one frame (call once per frame, before draw())
+	void animate(const sprite_anim *anims)
+	{
+		for (sprite_ram *sinfo = info; sinfo != &info[NumSprites]; sinfo++)
+		{
+			if (sinfo->anim == 0)
+				continue;
+			uint8_t t = sinfo->timer;
+			if (t > 1)				// still showing frame
+			{
+				sinfo->timer = t - 1;
+				continue;
+			}
+
+			const sprite_anim *adef = &anims[sinfo->anim - 1];
+			uint8_t f = sinfo->frame;
+			if (t != 0)				// time for next frame
+			{
+				uint8_t count = pgm_read_byte(&adef->count);
+				uint8_t mode = pgm_read_byte(&adef->mode);
+				uint8_t back = f & 0x80;
+				f &= 0x7f;
+				if (mode == SPRITE_ANIM_PINGPONG)
+				{
+					if (count > 1)
+					{
+						if (back ? f == 0 : f + 1 == count)
+							back ^= 0x80;
+						f = back ? f - 1 : f + 1;
+					}
+				}
+				else if (++f == count)
+				{
+					if (mode == SPRITE_ANIM_ONCE)
+					{
+						sinfo->anim = 0;	// done, leave last frame showing
+						continue;
+					}
+					f = 0;
+				}
+				f |= back;
+				sinfo->frame = f;
+			}
+
+			const uint8_t *fdat = (const uint8_t *)pgm_read_word(&adef->frames) + ((f & 0x7f) << 1);
+			sinfo->def = pgm_read_byte(fdat);
+			sinfo->timer = pgm_read_byte(fdat + 1);
+		}
+	}
+#endif
+
+#if SPRITE_BITMAP
+	// Soft bitmap drawing, in screen tile pixels (not scrolled, pixels off screen are dropped).  Cells touched
+	// get a RAM tile from the sprite allocator (or draw into the sprite tile there), removed again by clear().
+	// Call after clear() to draw under sprites, or after draw() to draw over them.
+	void plot(uint8_t x, uint8_t y, uint8_t pen)
+	{
+		if (x >= H_CHARS*8 || y >= V_CHARS*8)
+			return;
+		uint8_t *tram = bitmap_tile(x >> 3, y >> 3, true);
+		if (tram)
+			pen_line(tram + ((y & 0x7) * NUM_RAMTILES), pixels_from(x & 0x7) & ~pixels_from((x & 0x7) + 1), 1, pen);
+	}
+
+	void hline(uint8_t x, uint8_t y, uint8_t w, uint8_t pen)
+	{
+		fill_rect(x, y, w, 1, pen);
+	}
+
+	void vline(uint8_t x, uint8_t y, uint8_t h, uint8_t pen)
+	{
+		fill_rect(x, y, 1, h, pen);
+	}
+
+	// Bresenham line from x0, y0 to x1, y1 (inclusive)
+	void line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t pen)
+	{
+		if (y0 == y1 || x0 == x1)				// straight lines use spans
+		{
+			uint8_t x = x0 < x1 ? x0 : x1;
+			uint8_t y = y0 < y1 ? y0 : y1;
+			fill_rect(x, y, (x0 < x1 ? x1 - x0 : x0 - x1) + 1, (y0 < y1 ? y1 - y0 : y0 - y1) + 1, pen);
+			return;
+		}
+
+		int16_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+		int16_t dy = y1 > y0 ? y0 - y1 : y1 - y0;	// negative
+		int8_t sx = x0 < x1 ? 1 : -1;
+		int8_t sy = y0 < y1 ? 1 : -1;
+		int16_t err = dx + dy;
+		for (;;)
+		{
+			plot(x0, y0, pen);
+			if (x0 == x1 && y0 == y1)
+				break;
+			int16_t e2 = err * 2;
+			if (e2 >= dy)
+			{
+				err += dy;
+				x0 += sx;
+			}
+			if (e2 <= dx)
+			{
+				err += dx;
+				y0 += sy;
+			}
+		}
+	}
+
+	// filled w by h rectangle, whole cells are written a byte per line without copying the old tile
+	void fill_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t pen)
+	{
+		if (x >= H_CHARS*8 || y >= V_CHARS*8 || w == 0 || h == 0)
+			return;
+		if (w > H_CHARS*8 - x)
+			w = H_CHARS*8 - x;
+		if (h > V_CHARS*8 - y)
+			h = V_CHARS*8 - y;
+
+		uint8_t cy = y >> 3;
+		uint8_t line = y & 0x7;				// first line in cell
+		while (h)
+		{
+			uint8_t lines = 8 - line;
+			if (lines > h)
+				lines = h;
+
+			uint8_t cx = x >> 3;
+			uint8_t px = x & 0x7;			// first pixel in cell
+			uint8_t left = w;
+			while (left)
+			{
+				uint8_t n = 8 - px;
+				if (n > left)
+					n = left;
+				uint8_t mask = pixels_from(px) & ~pixels_from(px + n);
+				uint8_t whole = (lines == 8 && mask == 0xff && pen != SPRITE_PEN_XOR);
+				uint8_t *tram = bitmap_tile(cx, cy, !whole);
+				if (tram)
+					pen_line(tram + (line * NUM_RAMTILES), mask, lines, pen);
+				cx++;
+				px = 0;
+				left -= n;
+			}
+			cy++;
+			line = 0;
+			h -= lines;
+		}
+	}
+#endif
+
+	void clear()
+	{
+#if SPRITE_BITMAP || SPRITE_MISSILES
+		// soft bitmap cells (sprite tiles in them are finished off by each sprite's own pass)
+		if (bmp_x1)
+		{
+			restore_cells(((uint8_t *)ScreenMem) + (bmp_y0 * H_CHARS) + bmp_x0, bmp_x1 - bmp_x0, bmp_y1 - bmp_y0);
+			bmp_x1 = 0;
+		}
+#endif
+		// restore screen (in backwards order, required unless SPRITE_BG_LAYER)
+		for (int8_t n = NumSprites-1; n >= 0; n--)
+		{
+			uint8_t s = order_at(n);
+			info[s].def &= 0x7f;			// re-enable sprite if disabled for lack of RAM tiles
+
+			// cells covered when drawn (no need to clip sprite again)
+			sprite_cells *cells = &place[s];
+			if (cells->pos == 0)
+			{
+				continue;
+			}
+			restore_cells(cells->pos, cells->tw, cells->th);
+			cells->pos = 0;
+		}
+
+		next_sram_tile = 0;
+	}
+
+private:
+	// clipped image placement (from clip_image() for count_tiles() and draw_image())
+	struct sprite_clip
+	{
+		const uint8_t	*sdat;			// image data of first column drawn
+		const uint8_t	*span;			// span data of first column drawn
+		uint8_t		oh, h;			// image height and rows drawn
+		uint8_t		yskip;			// rows clipped off top
+		uint8_t		rshift;			// runtime shift multiplier (0 if pre-shifted)
+		uint8_t		sw;			// unshifted width in tiles (if runtime shifted)
+		uint8_t		col;			// first shifted column drawn
+		uint8_t		tx, ty, sy;		// top left tile and sub-tile Y pixel
+		uint8_t		tw, th;			// size in tiles
+	};
+
+	sprite_cells	place[NumSprites];
+#if SPRITE_BITMAP || SPRITE_MISSILES
+	uint8_t		bmp_x0, bmp_y0, bmp_x1, bmp_y1;	// cells drawn into by soft bitmap or missiles this frame (bmp_x1 0 if none)
+#endif
+#if SPRITE_BG_LAYER
+	uint8_t		BgMem[H_CHARS * V_CHARS];	// background tile under each cell covered by a sprite tile
+#else
+	char		save_tiles[SaveTiles];
+#endif
+#if SPRITE_COLLISION
+	uint8_t		tile_owner[CoverTiles];		// bits of sprites composited into each tracked RAM tile this frame
+	uint8_t		tile_cover[8 * CoverTiles];	// pixels covered by those sprites (line major like RAMTiles)
+	uint8_t		tile_under[NumMetas ? CoverTiles : 1];	// sprite tile each meta-sprite tile was drawn over (0xff none)
+	uint8_t		cover_scratch[8];		// coverage of cell being drawn into an untracked tile
+#endif
+#if SPRITE_SORT
+	uint8_t		order[NumSprites];		// sprite indices in draw order (cleared in reverse)
+#endif
+#if SPRITE_ROW_TILES
+	uint8_t		row_tiles[V_CHARS];		// sprite RAM tiles used in each tile row this frame
+#endif
+#if SPRITE_REGIONS
+	sprite_region	rgn;				// clip region of sprite being drawn
+
+	uint8_t clip_x0() const { return rgn.left; }
+	uint8_t clip_x1() const { return rgn.right; }
+	uint8_t clip_y0() const { return rgn.top; }
+	uint8_t clip_y1() const { return rgn.bottom; }
+	uint8_t clip_scroll() const { return rgn.scroll ? v_fine_scroll : 0; }
+#else
+	// constant clip rectangle (tests against 0 fold away)
+	static uint8_t clip_x0() { return ClipLeft; }
+	static uint8_t clip_x1() { return ClipRight; }
+	static uint8_t clip_y0() { return ClipTop; }
+	static uint8_t clip_y1() { return ClipBottom; }
+	static uint8_t clip_scroll() { return v_fine_scroll; }
+#endif
+
+	// restore any sprite tile in tw by th cells at spos (transparent cells were skipped when drawn)
+	void restore_cells(uint8_t *spos, uint8_t tw, uint8_t th)
+	{
+		for (uint8_t x = 0; x != tw; x++)
+		{
+			uint8_t *pos = spos + x;
+#if SPRITE_BG_LAYER
+			const uint8_t *bg = BgMem + (pos - (uint8_t *)ScreenMem);
+#endif
+			for (uint8_t y = 0; y != th; y++)
+			{
+				uint8_t t = *pos;
+				if (t >= 0x80 && (t & 0x7f) < next_sram_tile)
+				{
+#if SPRITE_BG_LAYER
+					*pos = *bg;
+#else
+					t &= 0x7f;
+					// unsaved tiles restored to BlankTile (may hold tile of earlier sprite, restored in turn)
+					if (t < SaveTiles)
+						*pos = save_tiles[t];
+					else
+						*pos = BlankTile;
+#endif
+				}
+				pos += H_CHARS;
+#if SPRITE_BG_LAYER
+				bg += H_CHARS;
+#endif
+			}
+		}
+	}
+
+	// copy 8 lines of old cell tile ot (ROM or RAM tile) into RAM tile line 0 at tram
+	static inline void copy_tile(uint8_t *tram, uint8_t ot)
+	{
+		if (ot < 0x80)
+		{
+			const uint8_t *rom = (const uint8_t *)((uint16_t)rom_tile_high<<8) + ot;
+
+			*tram = pgm_read_byte(rom);
+			rom += FONT_CHARS;
+			tram += NUM_RAMTILES;
+			*tram = pgm_read_byte(rom);
+			rom += FONT_CHARS;
+			tram += NUM_RAMTILES;
+			*tram = pgm_read_byte(rom);
+			rom += FONT_CHARS;
+			tram += NUM_RAMTILES;
+			*tram = pgm_read_byte(rom);
+			rom += FONT_CHARS;
+			tram += NUM_RAMTILES;
+			*tram = pgm_read_byte(rom);
+			rom += FONT_CHARS;
+			tram += NUM_RAMTILES;
+			*tram = pgm_read_byte(rom);
+			rom += FONT_CHARS;
+			tram += NUM_RAMTILES;
+			*tram = pgm_read_byte(rom);
+			rom += FONT_CHARS;
+			tram += NUM_RAMTILES;
+			*tram = pgm_read_byte(rom);
+		}
+		else
+		{
+			uint8_t *ram = &RAMTiles[ot&0x7f];
+
+			*tram = *ram;
+			tram += NUM_RAMTILES;
+			ram += NUM_RAMTILES;
+			*tram = *ram;
+			tram += NUM_RAMTILES;
+			ram += NUM_RAMTILES;
+			*tram = *ram;
+			tram += NUM_RAMTILES;
+			ram += NUM_RAMTILES;
+			*tram = *ram;
+			tram += NUM_RAMTILES;
+			ram += NUM_RAMTILES;
+			*tram = *ram;
+			tram += NUM_RAMTILES;
+			ram += NUM_RAMTILES;
+			*tram = *ram;
+			tram += NUM_RAMTILES;
+			ram += NUM_RAMTILES;
+			*tram = *ram;
+			tram += NUM_RAMTILES;
+			ram += NUM_RAMTILES;
+			*tram = *ram;
+		}
+	}
+
+#if SPRITE_BITMAP || SPRITE_MISSILES
+	// RAM tile (line 0) of cell cx, cy for soft bitmap, taken on first touch (0 if out of RAM tiles),
+	// old tile is not copied unless copy (caller writes all 64 pixels)
+	uint8_t *bitmap_tile(uint8_t cx, uint8_t cy, uint8_t copy)
+	{
+		uint8_t *pos = ((uint8_t *)ScreenMem) + (cy * H_CHARS) + cx;
+		uint8_t ot = *pos;
+		if (ot >= 0x80 && (ot & 0x7f) < next_sram_tile)
+			return &RAMTiles[ot & 0x7f];		// cell already has a tile this frame
+
+		if (next_sram_tile + 1 >= NumTiles)		// out of RAM tiles?
+			return 0;
+		uint8_t nt = next_sram_tile++;
+#if SPRITE_BG_LAYER
+		BgMem[pos - (uint8_t *)ScreenMem] = ot;
+#else
+		if (nt < SaveTiles)
+			save_tiles[nt] = ot;
+#endif
+#if SPRITE_COLLISION
+		if (nt < CoverTiles)
+		{
+			tile_owner[nt] = 0;			// bitmap pixels are background to sprites
+			for (uint8_t l = 0; l != 8; l++)
+				tile_cover[(l * CoverTiles) + nt] = 0;
+		}
+#endif
+		uint8_t *tram = &RAMTiles[nt];
+		if (copy)
+			copy_tile(tram, ot);
+		*pos = 0x80 | nt;
+
+		if (bmp_x1 == 0)
+		{
+			bmp_x0 = cx;
+			bmp_y0 = cy;
+			bmp_x1 = cx + 1;
+			bmp_y1 = cy + 1;
+		}
+		else
+		{
+			if (cx < bmp_x0)
+				bmp_x0 = cx;
+			if (cy < bmp_y0)
+				bmp_y0 = cy;
+			if (cx >= bmp_x1)
+				bmp_x1 = cx + 1;
+			if (cy >= bmp_y1)
+				bmp_y1 = cy + 1;
+		}
+
+		return tram;
+	}
+
+	// apply pen to mask pixels of lines tile lines from tram
+	static void pen_line(uint8_t *tram, uint8_t mask, uint8_t lines, uint8_t pen)
+	{
+		do
+		{
+			if (pen == SPRITE_PEN_XOR)
+				*tram ^= mask;
+			else if (pen == SPRITE_PEN_SET)
+				*tram |= mask;
+			else
+				*tram &= ~mask;
+			tram += NUM_RAMTILES;
+		} while (--lines);
+	}
+#endif
+
+#if SPRITE_MISSILES
+	// visible pixels of cell column cx (missiles are clipped to Clip* rectangle)
+	static uint8_t clip_cell(uint8_t cx)
+	{
+		if (cx >= H_CHARS)
+			return 0;
+		uint8_t px = cx << 3;
+		uint8_t mask = 0xff;
+		if (ClipLeft > px)
+			mask = ClipLeft - px < 8 ? pixels_from(ClipLeft - px) : 0;
+		if (ClipRight < px + 8)
+			mask &= ClipRight > px ? ~pixels_from(ClipRight - px) : 0;
+		return mask;
+	}
+
+	// OR, XOR or clear missile line bytes into RAM tiles of the (at most 2x2) cells under each missile
+	void draw_missiles()
+	{
+#if SPRITE_COLLISION
+		missile_bg_hits = 0;
+#endif
+		uint8_t clip_bottom = ClipBottom + v_fine_scroll;
+		for (uint8_t n = 0; n != SPRITE_MISSILES; n++)
+		{
+			sprite_missile *m = &missiles[n];
+#if SPRITE_COLLISION
+			missile_hits[n] = 0;
+#endif
+			if (m->h == 0)
+				continue;
+
+			uint8_t cx = m->x >> 3;
+			uint8_t sx = m->x & 0x7;
+			uint8_t lmask = clip_cell(cx);
+			uint8_t rmask = clip_cell(cx + 1);
+			uint8_t y = m->y + v_fine_scroll;
+			for (uint8_t l = 0; l != m->h; l++, y++)
+			{
+				uint8_t b = m->lines[l];
+				if (b == 0 || y < ClipTop || y >= clip_bottom)
+					continue;
+
+				// split line across two cells
+#if VIDEO_LITTLE_ENDIAN
+				uint8_t left = (b << sx) & lmask;
+				uint8_t right = sx ? (b >> (8 - sx)) & rmask : 0;
+#else
+				uint8_t left = (b >> sx) & lmask;
+				uint8_t right = sx ? (b << (8 - sx)) & rmask : 0;
+#endif
+				if (left)
+					missile_line(n, cx, y, left);
+				if (right)
+					missile_line(n, cx + 1, y, right);
+			}
+		}
+	}
+
+	void missile_line(uint8_t n, uint8_t cx, uint8_t y, uint8_t mask)
+	{
+		uint8_t *tram = bitmap_tile(cx, y >> 3, true);
+		if (tram == 0)
+			return;
+#if SPRITE_COLLISION
+		uint8_t nt = tram - RAMTiles;
+#endif
+		tram += (y & 0x7) * NUM_RAMTILES;
+#if SPRITE_COLLISION
+		uint8_t cover = 0;
+		if (nt < CoverTiles)
+		{
+			cover = tile_cover[((y & 0x7) * CoverTiles) + nt];
+			if (cover & mask)
+				missile_hits[n] |= tile_owner[nt];
+		}
+		if (*tram & mask & ~cover)
+			missile_bg_hits |= _BV(n);
+#endif
+		pen_line(tram, mask, 1, missiles[n].pen);
+	}
+#endif
+
+	uint8_t order_at(uint8_t n) const
+	{
+#if SPRITE_SORT
+		return order[n];
+#else
+		return n;
+#endif
+	}
+
+#if SPRITE_SORT
+	// insertion sort sprites by top screen Y (sprites wrapped or clipped off top sort first)
+	void sort()
+	{
+		uint8_t key[NumSprites];			// top screen Y of each sprite
+		for (uint8_t n = 0; n < NumSprites; n++)
+		{
+#if SPRITE_REGIONS
+			uint8_t scroll = pgm_read_byte(&Regions[info[n].region].scroll) ? v_fine_scroll : 0;
+			uint8_t clip_bottom = pgm_read_byte(&Regions[info[n].region].bottom) + scroll;
+#else
+			uint8_t scroll = v_fine_scroll;
+			uint8_t clip_bottom = ClipBottom + scroll;
+#endif
+			uint8_t y = info[n].y + scroll;
+			if (y >= clip_bottom)
+				y = 0;
+			key[n] = y;
+
+			uint8_t i = n;
+			while (i > 0)
+			{
+				if (key[order[i-1]] <= y)
+					break;
+				order[i] = order[i-1];
+				i--;
+			}
+			order[i] = n;
+		}
+	}
+#endif
+
+#if SPRITE_COLLISION
+	void collide(uint8_t s, uint8_t sbit, uint8_t owners)
+	{
+		hits[s] |= owners;
+		uint8_t *h = hits;
+		do
+		{
+			if (owners & 1)
+				*h |= sbit;
+			h++;
+			owners >>= 1;
+		} while (owners);
+	}
+#endif
+
+	// clip image def (0 based) placed at x, y (before v_fine_scroll), returns false if totally clipped
+	bool clip_image(sprite_clip *c, uint8_t def, uint8_t x, uint8_t y)
+	{
+		const sprite_rom *sdef = &Defs[def];
+
+		// X calculations (only size is read until sprite is known to be visible)
+		uint8_t w = pgm_read_byte(&sdef->w);
+		uint8_t ow = w;					// original width
+		uint8_t oh = pgm_read_byte(&sdef->h);		// original height
+		uint8_t shift = x & 0x7;			// image shifted right 0-7 pixels
+		uint8_t col = 0;				// shifted column being drawn
+		uint8_t yskip = 0;				// rows clipped off top
+
+		// if X off right or left edge (left test folds away when 0)
+		uint8_t clip_left = clip_x0();
+		uint8_t clip_right = clip_x1();
+		uint8_t xw = x + w;
+		if ((clip_left > 0 && x < clip_left) || x >= clip_right)
+		{
+			// check if sprite (X+width may wrap around) reaches left edge
+			uint8_t skip = clip_left - x;		// pixels before left edge
+			if (skip < w)
+			{
+				col = (skip + 7)>>3;
+				x = clip_left;
+				w -= skip;
+				if (w > clip_right - clip_left)
+					w = clip_right - clip_left;	// also past right edge
+			}
+			else
+			{
+				return false;			// totally clipped
+			}
+		}
+		else if (xw >= clip_right)
+		{
+			w = clip_right - x;
+		}
+
+		uint8_t tx = x >> 3;				// tile X pos (left edge of sprite)
+		uint8_t sx = x & 0x7;				// sub-tile X pixel (0-7)
+		uint8_t tw = (((uint16_t)w + sx + 7) >> 3);	// width in tiles
+
+		// Y calculations
+		uint8_t scroll = clip_scroll();
+		uint8_t clip_top = clip_y0();
+		uint8_t clip_bottom = clip_y1() + scroll;
+		y += scroll;					// desired Y position
+		uint8_t h = oh;					// sprite height (starts same as original height)
+
+		uint8_t yh = y + h;
+		if ((clip_top > 0 && y < clip_top) || y >= clip_bottom)
+		{
+			// check if sprite (Y+height may wrap around) reaches top edge
+			yskip = clip_top - y;			// rows before top edge
+			if (yskip < h)
+			{
+				y = clip_top;
+				h -= yskip;
+				if (h > clip_bottom - clip_top)
+					h = clip_bottom - clip_top;	// also past bottom edge
+			}
+			else
+			{
+				return false;			// totally clipped
+			}
+		}
+		else if (yh >= clip_bottom)
+		{
+			h = clip_bottom - y;
+		}
+
+		// visible, so fetch image and spans of first column and row drawn
+		const uint8_t *sdat = pgm_read_word(&sdef->image[shift]);	// select pre-shifted sprite data
+		uint8_t rshift = 0;						// runtime shift multiplier (0 if pre-shifted)
+		uint8_t sw = 0;							// unshifted width in tiles (if runtime shifted)
+		if (sdat == 0)							// no pre-shifted data, shift unshifted image at runtime
+		{
+			sdat = pgm_read_word(&sdef->image[0]);
+			rshift = _BV(8 - shift);
+			sw = (ow + 7) >> 3;
+		}
+		sdat += ((oh * 2) * col) + (yskip << 1);
+		const uint8_t *span = (const uint8_t *)pgm_read_word(&sdef->span[shift]) + (col * 4);	// opaque/visible rows of each column
+
+		uint8_t ty = y >> 3;				// tile Y pos
+		uint8_t sy = y & 0x7;				// sub-tile Y pixel (0-7)
+		uint8_t th = (((uint16_t)h + sy + 7) >> 3);	// height in tiles
+
+		c->sdat = sdat;
+		c->span = span;
+		c->oh = oh;
+		c->h = h;
+		c->yskip = yskip;
+		c->rshift = rshift;
+		c->sw = sw;
+		c->col = col;
+		c->tx = tx;
+		c->ty = ty;
+		c->sy = sy;
+		c->tw = tw;
+		c->th = th;
+
+		return true;
+
+	}
+
+	// count RAM tiles needed for visible rows of clipped image (fully transparent cells above and below are skipped)
+	uint8_t count_tiles(const sprite_clip *c, uint8_t *rowt)
+	{
+		uint8_t numt = 0;
+		const uint8_t *vspan = c->span + 2;
+		for (uint8_t x = 0; x != c->tw; x++)
+		{
+			uint8_t vlo = span_row(pgm_read_byte(vspan), c->yskip, c->h);
+			uint8_t vhi = span_row(pgm_read_byte(vspan+1), c->yskip, c->h);
+			if (vlo < vhi)
+			{
+				uint8_t r0 = (c->sy + vlo) >> 3;
+				uint8_t r1 = (c->sy + vhi - 1) >> 3;
+				numt += r1 - r0 + 1;
+#if SPRITE_ROW_TILES
+				r0 += c->ty;
+				r1 += c->ty;
+				do
+				{
+					rowt[r0]++;
+				} while (r0++ != r1);
+#endif
+			}
+			vspan += 4;
+		}
+
+		return numt;
+	}
+
+	// returns false if numt tiles (rowt in each tile row) are not available, otherwise reserves row tiles
+	bool alloc_tiles(uint8_t numt, const uint8_t *rowt)
+	{
+		if (next_sram_tile + numt >= NumTiles)	// out of RAM tiles for sprites?
+		{
+			return false;
+		}
+#if SPRITE_ROW_TILES
+		// fail if any tile row would go over limit
+		for (uint8_t r = 0; r != V_CHARS; r++)
+		{
+			if (row_tiles[r] + rowt[r] > SPRITE_ROW_TILES)
+				return false;
+		}
+		for (uint8_t r = 0; r != V_CHARS; r++)
+		{
+			row_tiles[r] += rowt[r];
+		}
+#endif
+		return true;
+	}
+
+	// true unless pos to pos+len is totally clipped by lo to hi (same test as clip_image())
+	static bool visible(uint8_t pos, uint8_t len, uint8_t lo, uint8_t hi)
+	{
+		if ((lo > 0 && pos < lo) || pos >= hi)
+			return (uint8_t)(lo - pos) < len;	// reaches lo (may also pass hi)
+		return true;
+	}
+
+	// composite clipped image for sprite s into RAM tiles (cells holding tiles from group on are shared)
+	void draw_image(const sprite_clip *c, uint8_t s, uint8_t group)
+	{
+#if SPRITE_COLLISION
+		uint8_t sbit = _BV(s);
+#endif
+		const uint8_t *sdat = c->sdat;
+		const uint8_t *span = c->span;
+		uint8_t oh = c->oh;
+		uint8_t h = c->h;
+		uint8_t yskip = c->yskip;
+		uint8_t rshift = c->rshift;
+		uint8_t sw = c->sw;
+		uint8_t col = c->col;
+		uint8_t sy = c->sy;
+		uint8_t tw = c->tw;
+		uint8_t *spos = ((uint8_t *)ScreenMem) + (c->ty * H_CHARS) + c->tx;	// top left cell
+		uint8_t x, y;
+
+		for (x = 0; x != tw; x++, col++)
+		{
+			const uint8_t *srom = sdat;
+			const uint8_t *sprev = sdat - (oh * 2);		// column to left (if runtime shifted)
+			sdat += oh * 2;
+
+			// opaque and visible row runs of this column (relative to clipped top)
+			uint8_t olo = span_row(pgm_read_byte(span++), yskip, h);
+			uint8_t ohi = span_row(pgm_read_byte(span++), yskip, h);
+			uint8_t vlo = span_row(pgm_read_byte(span++), yskip, h);
+			uint8_t vhi = span_row(pgm_read_byte(span++), yskip, h);
+			if (vlo >= vhi)
+				continue;				// column fully transparent
+
+			// start at first visible row
+			uint8_t line = sy + vlo;			// line from top of first tile
+			uint8_t *pos = spos + x;
+			if (line >= 8)
+				pos += (line >> 3) * H_CHARS;
+#if SPRITE_BG_LAYER
+			uint8_t *bg = BgMem + (pos - (uint8_t *)ScreenMem);
+#endif
+			srom += vlo * 2;
+			sprev += vlo * 2;
+
+			uint8_t *tram = 0;
+			uint8_t nt;
+			uint8_t tc = line & 0x7;
+			uint8_t opaque = 0;
+#if SPRITE_PRIORITY
+			const uint8_t *prom = 0;			// priority mask line of background tile
+			uint8_t pstep = 0;				// FONT_CHARS (or 0 if no priority tile)
+#endif
+#if SPRITE_COLLISION
+			uint8_t hit = 0;				// covered earlier sprite pixels in cell
+			uint8_t owners = 0;
+			uint8_t *cov = 0;				// coverage line of cell tile
+			uint8_t cstep = 0;				// CoverTiles (or 1 for cover_scratch)
+			const uint8_t *pcov = 0;			// coverage line of earlier sprites in cell
+			uint8_t pcstep = 0;				// CoverTiles (or 0 if no earlier tracked sprite tile)
+#endif
+			for (y = vlo; y != vhi; y++)
+			{
+				if (tc == 0 || y == vlo)
+				{
+					uint8_t ot = *pos;
+					// cell already holding a tile of this meta-sprite is drawn into again
+					uint8_t reuse = NumMetas && ot >= (0x80 | group) && (ot & 0x7f) < next_sram_tile;
+					nt = reuse ? (ot & 0x7f) : next_sram_tile++;
+#if SPRITE_COLLISION
+					if (hit)
+					{
+						collide(s, sbit, owners);	// resolve previous cell
+						hit = 0;
+					}
+					uint8_t under = 0xff;
+					owners = 0;
+					if (reuse)
+					{
+						if (nt < CoverTiles)
+						{
+							owners = tile_owner[nt] & ~sbit;
+							under = NumMetas ? tile_under[nt] : 0xff;
+						}
+					}
+					else
+					{
+						if ((ot & 0x80) && (ot & 0x7f) < nt && (ot & 0x7f) < CoverTiles)
+						{
+							under = ot & 0x7f;
+							owners = tile_owner[under];
+						}
+						if (nt < CoverTiles)
+						{
+							tile_owner[nt] = owners | sbit;
+							if (NumMetas)
+								tile_under[nt] = under;
+							for (uint8_t l = 0; l != 8; l++)	// start with coverage of earlier sprites
+								tile_cover[(l * CoverTiles) + nt] = under != 0xff ? tile_cover[(l * CoverTiles) + under] : 0;
+						}
+					}
+					pcov = &sprite_no_cover;
+					pcstep = 0;
+					if (under != 0xff)
+					{
+						pcov = &tile_cover[under];
+						pcstep = CoverTiles;
+					}
+					if (nt < CoverTiles)
+					{
+						cov = &tile_cover[nt];
+						cstep = CoverTiles;
+					}
+					else					// untracked tile (coverage only kept while drawing cell)
+					{
+						cov = cover_scratch;
+						cstep = 1;
+						for (uint8_t l = 0; l != 8; l++)
+							cover_scratch[l] = pcov[l * pcstep];
+					}
+#endif
+					if (!reuse)
+					{
+#if SPRITE_BG_LAYER
+						// keep background tile unless cell already holds a sprite tile from this frame
+						if (ot < 0x80 || (ot & 0x7f) >= nt)
+						{
+							*bg = ot;
+						}
+#else
+						// if room, save old tile (unsaved tiles restored to BlankTile)
+						if (nt < SaveTiles)
+						{
+							save_tiles[nt] = ot;
+						}
+#endif
+					}
+#if SPRITE_PRIORITY
+					// ROM tile under any sprite tiles in cell selects priority mask
+					prom = &sprite_no_priority;
+					pstep = 0;
+					if (priority_high)
+					{
+#if SPRITE_BG_LAYER
+						uint8_t pt = *bg;
+#else
+						uint8_t pt = ot;
+						uint8_t lim = nt + reuse;		// sprite tiles from this frame are below lim
+						while (pt >= 0x80 && (pt & 0x7f) < lim)
+						{
+							lim = pt & 0x7f;
+							pt = lim < SaveTiles ? save_tiles[lim] : BlankTile;
+						}
+#endif
+						if (pt < 0x80)
+						{
+							prom = (const uint8_t *)((uint16_t)priority_high<<8) + pt;
+							pstep = FONT_CHARS;
+						}
+					}
+#endif
+#if SPRITE_BG_LAYER
+					bg += H_CHARS;
+#endif
+
+					tram = &RAMTiles[nt];
+#if !SPRITE_COLLISION	// collisions need the old tile
+					opaque = (tc == 0 && y >= olo && y + 8 <= ohi);
+#if SPRITE_PRIORITY
+					opaque &= (pstep == 0);			// hidden pixels need the old tile
+#endif
+#endif
+					if (!opaque && !reuse)			// cell fully covered by opaque rows needs no copy of old tile
+					{
+						copy_tile(tram, ot);
+					}
+					*pos = 0x80 | nt;
+					pos += H_CHARS;
+
+					tram = &RAMTiles[nt];
+					if (y == vlo)
+					{
+						tram += tc*NUM_RAMTILES;
+#if SPRITE_PRIORITY
+						prom += tc*pstep;
+#endif
+#if SPRITE_COLLISION
+						cov += tc*cstep;
+						pcov += tc*pcstep;
+#endif
+					}
+				}
+				tc = (tc + 1) & 0x7;
+				uint8_t m, b;
+				if (rshift == 0)
+				{
+					m = pgm_read_byte(srom++);
+					b = pgm_read_byte(srom++);
+				}
+				else
+				{
+					uint8_t mc = 0xff, bc = 0x00, mp = 0xff, bp = 0x00;	// transparent outside of image
+					if (col < sw)
+					{
+						mc = pgm_read_byte(srom++);
+						bc = pgm_read_byte(srom++);
+					}
+					if (col != 0)
+					{
+						mp = pgm_read_byte(sprev++);
+						bp = pgm_read_byte(sprev++);
+					}
+					m = shift_merge(mc, mp, rshift);
+					b = shift_merge(bc, bp, rshift);
+				}
+#if SPRITE_PRIORITY
+				uint8_t p = pgm_read_byte(prom);		// background pixels in front of sprite
+				prom += pstep;
+#endif
+#if SPRITE_COLLISION
+				uint8_t t = *tram;
+				uint8_t own = b | ~m;			// black, white or XOR sprite pixels (hidden or not)
+				hit |= own & *pcov;			// earlier sprites (read before cov, same line for a new tile)
+				pcov += pcstep;
+				uint8_t c = *cov;			// earlier sprites and earlier parts of this meta-sprite
+				if (own & t & ~c)			// set background pixels
+					bg_hits |= sbit;
+				*cov = c | own;
+				cov += cstep;
+#if SPRITE_PRIORITY
+				m |= p;
+				b &= ~p;
+#endif
+				*tram = (t & m) ^ b;
+#else
+#if SPRITE_PRIORITY
+				m |= p;
+				b &= ~p;
+#endif
+				if (opaque)
+					*tram = b;
+				else
+					*tram = (*tram & m) ^ b;
+#endif
+				tram += NUM_RAMTILES;
+			}
+#if SPRITE_COLLISION
+			if (hit)
+				collide(s, sbit, owners);
+#endif
+		}
+	}
+};
+
+#endif // AVRINVADERS_SPRITES_H
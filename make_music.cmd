@@ -0,0 +1,3 @@
+#! /bin/bash
+"utilities/crunch_music" title_music.txt > title_music.h
+"utilities/crunch_sample" zap.wav > zap_sample.h
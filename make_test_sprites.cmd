@@ -1,2 +1,2 @@
 #! /bin/bash
-"utilities/crunch_sprites" -v -v square.bmp smiley_test.bmp pixel.bmp pixel2.bmp pixel7.bmp XOR_test.bmp black_test.bmp ball_1.bmp death_star.bmp -n test_sprites
+"utilities/crunch_sprites" -v -v square.bmp smiley_test.bmp pixel.bmp pixel2.bmp pixel7.bmp XOR_test.bmp black_test.bmp ball_1.bmp -r death_star.bmp -m boot_group=death_star:0:0,square:24:24,XOR_test:56:56 -a all_images=square:60,smiley_test:60,pixel:60,pixel2:60,pixel7:60,XOR_test:60,black_test:60,ball_1:60,death_star:60 -n test_sprites
@@ -191,6 +191,11 @@ const uint8_t square_bmap_0[1*8*2] PROGMEM =
 	0x00,0xff,0x00,0x81,0x00,0xa5,0x00,0x81,0x00,0x81,0x00,0xa5,0x00,0x99,0x00,0xc3,
 };
 
+const uint8_t square_span_0[1*4] PROGMEM =
+{
+	0,8, 0,8,
+};
+
 const uint8_t square_bmap_1[2*8*2] PROGMEM =
 {
 // Bitmap shift 1 (8+1 x 8):
@@ -216,6 +221,12 @@ const uint8_t square_bmap_1[2*8*2] PROGMEM =
 	0x7f,0x80,0x7f,0x80,0x7f,0x80,0x7f,0x80,0x7f,0x80,0x7f,0x80,0x7f,0x80,0x7f,0x80,
 };
 
+const uint8_t square_span_1[2*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t square_bmap_2[2*8*2] PROGMEM =
 {
 // Bitmap shift 2 (8+2 x 8):
@@ -241,6 +252,12 @@ const uint8_t square_bmap_2[2*8*2] PROGMEM =
 	0x3f,0xc0,0x3f,0x40,0x3f,0x40,0x3f,0x40,0x3f,0x40,0x3f,0x40,0x3f,0x40,0x3f,0xc0,
 };
 
+const uint8_t square_span_2[2*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t square_bmap_3[2*8*2] PROGMEM =
 {
 // Bitmap shift 3 (8+3 x 8):
@@ -266,6 +283,12 @@ const uint8_t square_bmap_3[2*8*2] PROGMEM =
 	0x1f,0xe0,0x1f,0x20,0x1f,0xa0,0x1f,0x20,0x1f,0x20,0x1f,0xa0,0x1f,0x20,0x1f,0x60,
 };
 
+const uint8_t square_span_3[2*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t square_bmap_4[2*8*2] PROGMEM =
 {
 // Bitmap shift 4 (8+4 x 8):
@@ -291,6 +314,12 @@ const uint8_t square_bmap_4[2*8*2] PROGMEM =
 	0x0f,0xf0,0x0f,0x10,0x0f,0x50,0x0f,0x10,0x0f,0x10,0x0f,0x50,0x0f,0x90,0x0f,0x30,
 };
 
+const uint8_t square_span_4[2*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t square_bmap_5[2*8*2] PROGMEM =
 {
 // Bitmap shift 5 (8+5 x 8):
@@ -316,6 +345,12 @@ const uint8_t square_bmap_5[2*8*2] PROGMEM =
 	0x07,0xf8,0x07,0x08,0x07,0x28,0x07,0x08,0x07,0x08,0x07,0x28,0x07,0xc8,0x07,0x18,
 };
 
+const uint8_t square_span_5[2*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t square_bmap_6[2*8*2] PROGMEM =
 {
 // Bitmap shift 6 (8+6 x 8):
@@ -341,6 +376,12 @@ const uint8_t square_bmap_6[2*8*2] PROGMEM =
 	0x03,0xfc,0x03,0x04,0x03,0x94,0x03,0x04,0x03,0x04,0x03,0x94,0x03,0x64,0x03,0x0c,
 };
 
+const uint8_t square_span_6[2*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t square_bmap_7[2*8*2] PROGMEM =
 {
 // Bitmap shift 7 (8+7 x 8):
@@ -366,6 +407,12 @@ const uint8_t square_bmap_7[2*8*2] PROGMEM =
 	0x01,0xfe,0x01,0x02,0x01,0x4a,0x01,0x02,0x01,0x02,0x01,0x4a,0x01,0x32,0x01,0x86,
 };
 
+const uint8_t square_span_7[2*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 // #1 (0x01) - "smiley_test" (16 x 16)
 const uint8_t smiley_test_bmap_0[2*16*2] PROGMEM =
 {
@@ -408,6 +455,12 @@ const uint8_t smiley_test_bmap_0[2*16*2] PROGMEM =
 	0x0f,0x00,0x07,0xf0,0x03,0xf8,0x01,0xfc,0x60,0xfe,0x60,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xe6,0x00,0x0e,0x00,0x1e,0x01,0x3c,0x03,0xf8,0x07,0xf0,0x0f,0x00,
 };
 
+const uint8_t smiley_test_span_0[2*4] PROGMEM =
+{
+	6,12, 0,16,
+	6,12, 0,16,
+};
+
 const uint8_t smiley_test_bmap_1[3*16*2] PROGMEM =
 {
 // Bitmap shift 1 (16+1 x 16):
@@ -450,6 +503,13 @@ const uint8_t smiley_test_bmap_1[3*16*2] PROGMEM =
 	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
 };
 
+const uint8_t smiley_test_span_1[3*4] PROGMEM =
+{
+	0,0, 0,16,
+	6,13, 0,16,
+	0,0, 4,12,
+};
+
 const uint8_t smiley_test_bmap_2[3*16*2] PROGMEM =
 {
 // Bitmap shift 2 (16+2 x 16):
@@ -492,6 +552,13 @@ const uint8_t smiley_test_bmap_2[3*16*2] PROGMEM =
 	0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
 };
 
+const uint8_t smiley_test_span_2[3*4] PROGMEM =
+{
+	0,0, 0,16,
+	6,14, 0,16,
+	0,0, 3,13,
+};
+
 const uint8_t smiley_test_bmap_3[3*16*2] PROGMEM =
 {
 // Bitmap shift 3 (16+3 x 16):
@@ -534,6 +601,13 @@ const uint8_t smiley_test_bmap_3[3*16*2] PROGMEM =
 	0xff,0x00,0xff,0x00,0x7f,0x00,0x3f,0x80,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x3f,0x80,0x7f,0x00,0xff,0x00,0xff,0x00,
 };
 
+const uint8_t smiley_test_span_3[3*4] PROGMEM =
+{
+	0,0, 0,16,
+	6,15, 0,16,
+	0,0, 2,14,
+};
+
 const uint8_t smiley_test_bmap_4[3*16*2] PROGMEM =
 {
 // Bitmap shift 4 (16+4 x 16):
@@ -576,6 +650,13 @@ const uint8_t smiley_test_bmap_4[3*16*2] PROGMEM =
 	0xff,0x00,0x7f,0x00,0x3f,0x80,0x1f,0xc0,0x0f,0xe0,0x0f,0xe0,0x0f,0xe0,0x0f,0xe0,0x0f,0xe0,0x0f,0x60,0x0f,0xe0,0x0f,0xe0,0x1f,0xc0,0x3f,0x80,0x7f,0x00,0xff,0x00,
 };
 
+const uint8_t smiley_test_span_4[3*4] PROGMEM =
+{
+	0,0, 1,15,
+	6,16, 0,16,
+	0,0, 1,15,
+};
+
 const uint8_t smiley_test_bmap_5[3*16*2] PROGMEM =
 {
 // Bitmap shift 5 (16+5 x 16):
@@ -618,6 +699,13 @@ const uint8_t smiley_test_bmap_5[3*16*2] PROGMEM =
 	0x7f,0x00,0x3f,0x80,0x1f,0xc0,0x0f,0xe0,0x07,0xf0,0x07,0xf0,0x07,0xf0,0x07,0xf0,0x07,0xf0,0x07,0x30,0x07,0x70,0x07,0xf0,0x0f,0xe0,0x1f,0xc0,0x3f,0x80,0x7f,0x00,
 };
 
+const uint8_t smiley_test_span_5[3*4] PROGMEM =
+{
+	0,0, 2,14,
+	6,15, 0,16,
+	0,0, 0,16,
+};
+
 const uint8_t smiley_test_bmap_6[3*16*2] PROGMEM =
 {
 // Bitmap shift 6 (16+6 x 16):
@@ -660,6 +748,13 @@ const uint8_t smiley_test_bmap_6[3*16*2] PROGMEM =
 	0x3f,0x00,0x1f,0xc0,0x0f,0xe0,0x07,0xf0,0x83,0xf8,0x83,0xf8,0x03,0xf8,0x03,0xf8,0x03,0xf8,0x03,0x98,0x03,0x38,0x03,0x78,0x07,0xf0,0x0f,0xe0,0x1f,0xc0,0x3f,0x00,
 };
 
+const uint8_t smiley_test_span_6[3*4] PROGMEM =
+{
+	0,0, 3,13,
+	6,14, 0,16,
+	0,0, 0,16,
+};
+
 const uint8_t smiley_test_bmap_7[3*16*2] PROGMEM =
 {
 // Bitmap shift 7 (16+7 x 16):
@@ -702,6 +797,13 @@ const uint8_t smiley_test_bmap_7[3*16*2] PROGMEM =
 	0x1f,0x00,0x0f,0xe0,0x07,0xf0,0x03,0xf8,0xc1,0xfc,0xc1,0xfc,0x01,0xfc,0x01,0xfc,0x01,0xfc,0x01,0xcc,0x01,0x1c,0x01,0x3c,0x03,0x78,0x07,0xf0,0x0f,0xe0,0x1f,0x00,
 };
 
+const uint8_t smiley_test_span_7[3*4] PROGMEM =
+{
+	0,0, 4,12,
+	6,13, 0,16,
+	0,0, 0,16,
+};
+
 // #2 (0x02) - "pixel" (1 x 1)
 const uint8_t pixel_bmap_0[1*1*2] PROGMEM =
 {
@@ -713,6 +815,11 @@ const uint8_t pixel_bmap_0[1*1*2] PROGMEM =
 	0x7f,0x80,
 };
 
+const uint8_t pixel_span_0[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel_bmap_1[1*1*2] PROGMEM =
 {
 // Bitmap shift 1 (1+1 x 1):
@@ -723,6 +830,11 @@ const uint8_t pixel_bmap_1[1*1*2] PROGMEM =
 	0xbf,0x40,
 };
 
+const uint8_t pixel_span_1[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel_bmap_2[1*1*2] PROGMEM =
 {
 // Bitmap shift 2 (1+2 x 1):
@@ -733,6 +845,11 @@ const uint8_t pixel_bmap_2[1*1*2] PROGMEM =
 	0xdf,0x20,
 };
 
+const uint8_t pixel_span_2[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel_bmap_3[1*1*2] PROGMEM =
 {
 // Bitmap shift 3 (1+3 x 1):
@@ -743,6 +860,11 @@ const uint8_t pixel_bmap_3[1*1*2] PROGMEM =
 	0xef,0x10,
 };
 
+const uint8_t pixel_span_3[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel_bmap_4[1*1*2] PROGMEM =
 {
 // Bitmap shift 4 (1+4 x 1):
@@ -753,6 +875,11 @@ const uint8_t pixel_bmap_4[1*1*2] PROGMEM =
 	0xf7,0x08,
 };
 
+const uint8_t pixel_span_4[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel_bmap_5[1*1*2] PROGMEM =
 {
 // Bitmap shift 5 (1+5 x 1):
@@ -763,6 +890,11 @@ const uint8_t pixel_bmap_5[1*1*2] PROGMEM =
 	0xfb,0x04,
 };
 
+const uint8_t pixel_span_5[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel_bmap_6[1*1*2] PROGMEM =
 {
 // Bitmap shift 6 (1+6 x 1):
@@ -773,6 +905,11 @@ const uint8_t pixel_bmap_6[1*1*2] PROGMEM =
 	0xfd,0x02,
 };
 
+const uint8_t pixel_span_6[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel_bmap_7[1*1*2] PROGMEM =
 {
 // Bitmap shift 7 (1+7 x 1):
@@ -783,6 +920,11 @@ const uint8_t pixel_bmap_7[1*1*2] PROGMEM =
 	0xfe,0x01,
 };
 
+const uint8_t pixel_span_7[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 // #3 (0x03) - "pixel2" (2 x 1)
 const uint8_t pixel2_bmap_0[1*1*2] PROGMEM =
 {
@@ -794,6 +936,11 @@ const uint8_t pixel2_bmap_0[1*1*2] PROGMEM =
 	0x3f,0xc0,
 };
 
+const uint8_t pixel2_span_0[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel2_bmap_1[1*1*2] PROGMEM =
 {
 // Bitmap shift 1 (2+1 x 1):
@@ -804,6 +951,11 @@ const uint8_t pixel2_bmap_1[1*1*2] PROGMEM =
 	0x9f,0x60,
 };
 
+const uint8_t pixel2_span_1[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel2_bmap_2[1*1*2] PROGMEM =
 {
 // Bitmap shift 2 (2+2 x 1):
@@ -814,6 +966,11 @@ const uint8_t pixel2_bmap_2[1*1*2] PROGMEM =
 	0xcf,0x30,
 };
 
+const uint8_t pixel2_span_2[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel2_bmap_3[1*1*2] PROGMEM =
 {
 // Bitmap shift 3 (2+3 x 1):
@@ -824,6 +981,11 @@ const uint8_t pixel2_bmap_3[1*1*2] PROGMEM =
 	0xe7,0x18,
 };
 
+const uint8_t pixel2_span_3[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel2_bmap_4[1*1*2] PROGMEM =
 {
 // Bitmap shift 4 (2+4 x 1):
@@ -834,6 +996,11 @@ const uint8_t pixel2_bmap_4[1*1*2] PROGMEM =
 	0xf3,0x0c,
 };
 
+const uint8_t pixel2_span_4[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel2_bmap_5[1*1*2] PROGMEM =
 {
 // Bitmap shift 5 (2+5 x 1):
@@ -844,6 +1011,11 @@ const uint8_t pixel2_bmap_5[1*1*2] PROGMEM =
 	0xf9,0x06,
 };
 
+const uint8_t pixel2_span_5[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel2_bmap_6[1*1*2] PROGMEM =
 {
 // Bitmap shift 6 (2+6 x 1):
@@ -854,6 +1026,11 @@ const uint8_t pixel2_bmap_6[1*1*2] PROGMEM =
 	0xfc,0x03,
 };
 
+const uint8_t pixel2_span_6[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel2_bmap_7[2*1*2] PROGMEM =
 {
 // Bitmap shift 7 (2+7 x 1):
@@ -865,6 +1042,12 @@ const uint8_t pixel2_bmap_7[2*1*2] PROGMEM =
 	0x7f,0x80,
 };
 
+const uint8_t pixel2_span_7[2*4] PROGMEM =
+{
+	0,0, 0,1,
+	0,0, 0,1,
+};
+
 // #4 (0x04) - "pixel7" (7 x 1)
 const uint8_t pixel7_bmap_0[1*1*2] PROGMEM =
 {
@@ -876,6 +1059,11 @@ const uint8_t pixel7_bmap_0[1*1*2] PROGMEM =
 	0x01,0xfe,
 };
 
+const uint8_t pixel7_span_0[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel7_bmap_1[1*1*2] PROGMEM =
 {
 // Bitmap shift 1 (7+1 x 1):
@@ -886,6 +1074,11 @@ const uint8_t pixel7_bmap_1[1*1*2] PROGMEM =
 	0x80,0x7f,
 };
 
+const uint8_t pixel7_span_1[1*4] PROGMEM =
+{
+	0,0, 0,1,
+};
+
 const uint8_t pixel7_bmap_2[2*1*2] PROGMEM =
 {
 // Bitmap shift 2 (7+2 x 1):
@@ -897,6 +1090,12 @@ const uint8_t pixel7_bmap_2[2*1*2] PROGMEM =
 	0x7f,0x80,
 };
 
+const uint8_t pixel7_span_2[2*4] PROGMEM =
+{
+	0,0, 0,1,
+	0,0, 0,1,
+};
+
 const uint8_t pixel7_bmap_3[2*1*2] PROGMEM =
 {
 // Bitmap shift 3 (7+3 x 1):
@@ -908,6 +1107,12 @@ const uint8_t pixel7_bmap_3[2*1*2] PROGMEM =
 	0x3f,0xc0,
 };
 
+const uint8_t pixel7_span_3[2*4] PROGMEM =
+{
+	0,0, 0,1,
+	0,0, 0,1,
+};
+
 const uint8_t pixel7_bmap_4[2*1*2] PROGMEM =
 {
 // Bitmap shift 4 (7+4 x 1):
@@ -919,6 +1124,12 @@ const uint8_t pixel7_bmap_4[2*1*2] PROGMEM =
 	0x1f,0xe0,
 };
 
+const uint8_t pixel7_span_4[2*4] PROGMEM =
+{
+	0,0, 0,1,
+	0,0, 0,1,
+};
+
 const uint8_t pixel7_bmap_5[2*1*2] PROGMEM =
 {
 // Bitmap shift 5 (7+5 x 1):
@@ -930,6 +1141,12 @@ const uint8_t pixel7_bmap_5[2*1*2] PROGMEM =
 	0x0f,0xf0,
 };
 
+const uint8_t pixel7_span_5[2*4] PROGMEM =
+{
+	0,0, 0,1,
+	0,0, 0,1,
+};
+
 const uint8_t pixel7_bmap_6[2*1*2] PROGMEM =
 {
 // Bitmap shift 6 (7+6 x 1):
@@ -941,6 +1158,12 @@ const uint8_t pixel7_bmap_6[2*1*2] PROGMEM =
 	0x07,0xf8,
 };
 
+const uint8_t pixel7_span_6[2*4] PROGMEM =
+{
+	0,0, 0,1,
+	0,0, 0,1,
+};
+
 const uint8_t pixel7_bmap_7[2*1*2] PROGMEM =
 {
 // Bitmap shift 7 (7+7 x 1):
@@ -952,6 +1175,12 @@ const uint8_t pixel7_bmap_7[2*1*2] PROGMEM =
 	0x03,0xfc,
 };
 
+const uint8_t pixel7_span_7[2*4] PROGMEM =
+{
+	0,0, 0,1,
+	0,0, 0,1,
+};
+
 // #5 (0x05) - "XOR_test" (30 x 8)
 const uint8_t XOR_test_bmap_0[4*8*2] PROGMEM =
 {
@@ -980,6 +1209,14 @@ const uint8_t XOR_test_bmap_0[4*8*2] PROGMEM =
 	0xff,0x10,0xff,0x38,0xff,0x38,0xff,0x38,0xff,0x10,0xff,0x00,0xff,0x10,0xff,0x10,
 };
 
+const uint8_t XOR_test_span_0[4*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t XOR_test_bmap_1[4*8*2] PROGMEM =
 {
 // Bitmap shift 1 (30+1 x 8):
@@ -1007,6 +1244,14 @@ const uint8_t XOR_test_bmap_1[4*8*2] PROGMEM =
 	0xff,0x08,0xff,0x9c,0xff,0x9c,0xff,0x1c,0xff,0x08,0xff,0x00,0xff,0x88,0xff,0x88,
 };
 
+const uint8_t XOR_test_span_1[4*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t XOR_test_bmap_2[4*8*2] PROGMEM =
 {
 // Bitmap shift 2 (30+2 x 8):
@@ -1034,6 +1279,14 @@ const uint8_t XOR_test_bmap_2[4*8*2] PROGMEM =
 	0xff,0x84,0xff,0xce,0xff,0xce,0xff,0x8e,0xff,0x04,0xff,0x80,0xff,0xc4,0xff,0xc4,
 };
 
+const uint8_t XOR_test_span_2[4*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t XOR_test_bmap_3[5*8*2] PROGMEM =
 {
 // Bitmap shift 3 (30+3 x 8):
@@ -1062,6 +1315,15 @@ const uint8_t XOR_test_bmap_3[5*8*2] PROGMEM =
 	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
 };
 
+const uint8_t XOR_test_span_3[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,0,
+};
+
 const uint8_t XOR_test_bmap_4[5*8*2] PROGMEM =
 {
 // Bitmap shift 4 (30+4 x 8):
@@ -1090,6 +1352,15 @@ const uint8_t XOR_test_bmap_4[5*8*2] PROGMEM =
 	0xff,0x00,0xff,0x80,0xff,0x80,0xff,0x80,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
 };
 
+const uint8_t XOR_test_span_4[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 1,4,
+};
+
 const uint8_t XOR_test_bmap_5[5*8*2] PROGMEM =
 {
 // Bitmap shift 5 (30+5 x 8):
@@ -1118,6 +1389,15 @@ const uint8_t XOR_test_bmap_5[5*8*2] PROGMEM =
 	0xff,0x80,0xff,0xc0,0xff,0xc0,0xff,0xc0,0xff,0x80,0xff,0x00,0xff,0x80,0xff,0x80,
 };
 
+const uint8_t XOR_test_span_5[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t XOR_test_bmap_6[5*8*2] PROGMEM =
 {
 // Bitmap shift 6 (30+6 x 8):
@@ -1146,6 +1426,15 @@ const uint8_t XOR_test_bmap_6[5*8*2] PROGMEM =
 	0xff,0x40,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0x40,0xff,0x00,0xff,0x40,0xff,0x40,
 };
 
+const uint8_t XOR_test_span_6[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t XOR_test_bmap_7[5*8*2] PROGMEM =
 {
 // Bitmap shift 7 (30+7 x 8):
@@ -1174,6 +1463,15 @@ const uint8_t XOR_test_bmap_7[5*8*2] PROGMEM =
 	0xff,0x20,0xff,0x70,0xff,0x70,0xff,0x70,0xff,0x20,0xff,0x00,0xff,0x20,0xff,0x20,
 };
 
+const uint8_t XOR_test_span_7[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+	0,0, 0,8,
+};
+
 // #6 (0x06) - "black_test" (34 x 8)
 const uint8_t black_test_bmap_0[5*8*2] PROGMEM =
 {
@@ -1203,6 +1501,15 @@ const uint8_t black_test_bmap_0[5*8*2] PROGMEM =
 	0x3f,0x40,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x40,0x3f,0xc0,0x3f,0x40,0x3f,0x40,
 };
 
+const uint8_t black_test_span_0[5*4] PROGMEM =
+{
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t black_test_bmap_1[5*8*2] PROGMEM =
 {
 // Bitmap shift 1 (34+1 x 8):
@@ -1231,6 +1538,15 @@ const uint8_t black_test_bmap_1[5*8*2] PROGMEM =
 	0x1f,0xa0,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0xa0,0x1f,0xe0,0x1f,0xa0,0x1f,0xa0,
 };
 
+const uint8_t black_test_span_1[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t black_test_bmap_2[5*8*2] PROGMEM =
 {
 // Bitmap shift 2 (34+2 x 8):
@@ -1259,6 +1575,15 @@ const uint8_t black_test_bmap_2[5*8*2] PROGMEM =
 	0x0f,0xd0,0x0f,0x80,0x0f,0x80,0x0f,0x80,0x0f,0xd0,0x0f,0xf0,0x0f,0xd0,0x0f,0xd0,
 };
 
+const uint8_t black_test_span_2[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t black_test_bmap_3[5*8*2] PROGMEM =
 {
 // Bitmap shift 3 (34+3 x 8):
@@ -1287,6 +1612,15 @@ const uint8_t black_test_bmap_3[5*8*2] PROGMEM =
 	0x07,0xe8,0x07,0xc0,0x07,0xc0,0x07,0xc0,0x07,0xe8,0x07,0xf8,0x07,0xe8,0x07,0xe8,
 };
 
+const uint8_t black_test_span_3[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t black_test_bmap_4[5*8*2] PROGMEM =
 {
 // Bitmap shift 4 (34+4 x 8):
@@ -1315,6 +1649,15 @@ const uint8_t black_test_bmap_4[5*8*2] PROGMEM =
 	0x03,0xf4,0x03,0x60,0x03,0x60,0x03,0xe0,0x03,0xf4,0x03,0xfc,0x03,0x74,0x03,0x74,
 };
 
+const uint8_t black_test_span_4[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t black_test_bmap_5[5*8*2] PROGMEM =
 {
 // Bitmap shift 5 (34+5 x 8):
@@ -1343,6 +1686,15 @@ const uint8_t black_test_bmap_5[5*8*2] PROGMEM =
 	0x01,0xfa,0x01,0x30,0x01,0x30,0x01,0x70,0x01,0xfa,0x01,0x7e,0x01,0x3a,0x01,0x3a,
 };
 
+const uint8_t black_test_span_5[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,0, 0,8,
+};
+
 const uint8_t black_test_bmap_6[5*8*2] PROGMEM =
 {
 // Bitmap shift 6 (34+6 x 8):
@@ -1371,6 +1723,15 @@ const uint8_t black_test_bmap_6[5*8*2] PROGMEM =
 	0x00,0xfd,0x00,0x98,0x00,0x98,0x00,0x38,0x00,0x7d,0x00,0x3f,0x00,0x9d,0x00,0x9d,
 };
 
+const uint8_t black_test_span_6[5*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+};
+
 const uint8_t black_test_bmap_7[6*8*2] PROGMEM =
 {
 // Bitmap shift 7 (34+7 x 8):
@@ -1400,6 +1761,16 @@ const uint8_t black_test_bmap_7[6*8*2] PROGMEM =
 	0x7f,0x80,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x80,0x7f,0x80,0x7f,0x80,0x7f,0x80,
 };
 
+const uint8_t black_test_span_7[6*4] PROGMEM =
+{
+	0,0, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,8, 0,8,
+	0,0, 0,8,
+};
+
 // #7 (0x07) - "ball_1" (16 x 16)
 const uint8_t ball_1_bmap_0[2*16*2] PROGMEM =
 {
@@ -1442,6 +1813,12 @@ const uint8_t ball_1_bmap_0[2*16*2] PROGMEM =
 	0x1f,0x00,0x07,0xe0,0x03,0xf8,0x01,0xfc,0x01,0x7c,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x01,0x3c,0x01,0xfc,0x03,0xf8,0x07,0xe0,0x1f,0x00,
 };
 
+const uint8_t ball_1_span_0[2*4] PROGMEM =
+{
+	5,11, 0,16,
+	5,11, 0,16,
+};
+
 const uint8_t ball_1_bmap_1[3*16*2] PROGMEM =
 {
 // Bitmap shift 1 (16+1 x 16):
@@ -1484,6 +1861,13 @@ const uint8_t ball_1_bmap_1[3*16*2] PROGMEM =
 	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
 };
 
+const uint8_t ball_1_span_1[3*4] PROGMEM =
+{
+	0,0, 0,16,
+	3,13, 0,16,
+	0,0, 5,11,
+};
+
 const uint8_t ball_1_bmap_2[3*16*2] PROGMEM =
 {
 // Bitmap shift 2 (16+2 x 16):
@@ -1526,6 +1910,13 @@ const uint8_t ball_1_bmap_2[3*16*2] PROGMEM =
 	0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x7f,0x00,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x7f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
 };
 
+const uint8_t ball_1_span_2[3*4] PROGMEM =
+{
+	0,0, 0,16,
+	2,14, 0,16,
+	0,0, 3,13,
+};
+
 const uint8_t ball_1_bmap_3[3*16*2] PROGMEM =
 {
 // Bitmap shift 3 (16+3 x 16):
@@ -1568,6 +1959,13 @@ const uint8_t ball_1_bmap_3[3*16*2] PROGMEM =
 	0xff,0x00,0xff,0x00,0x7f,0x00,0x3f,0x80,0x3f,0x80,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x1f,0xc0,0x3f,0x80,0x3f,0x80,0x7f,0x00,0xff,0x00,0xff,0x00,
 };
 
+const uint8_t ball_1_span_3[3*4] PROGMEM =
+{
+	0,0, 1,15,
+	1,15, 0,16,
+	0,0, 2,14,
+};
+
 const uint8_t ball_1_bmap_4[3*16*2] PROGMEM =
 {
 // Bitmap shift 4 (16+4 x 16):
@@ -1610,6 +2008,13 @@ const uint8_t ball_1_bmap_4[3*16*2] PROGMEM =
 	0xff,0x00,0x7f,0x00,0x3f,0x80,0x1f,0xc0,0x1f,0xc0,0x0f,0xe0,0x0f,0xe0,0x0f,0xe0,0x0f,0xe0,0x0f,0xe0,0x0f,0xe0,0x1f,0xc0,0x1f,0xc0,0x3f,0x80,0x7f,0x00,0xff,0x00,
 };
 
+const uint8_t ball_1_span_4[3*4] PROGMEM =
+{
+	0,0, 1,15,
+	1,15, 0,16,
+	0,0, 1,15,
+};
+
 const uint8_t ball_1_bmap_5[3*16*2] PROGMEM =
 {
 // Bitmap shift 5 (16+5 x 16):
@@ -1652,6 +2057,13 @@ const uint8_t ball_1_bmap_5[3*16*2] PROGMEM =
 	0xff,0x00,0x3f,0x00,0x1f,0xc0,0x0f,0xe0,0x0f,0xe0,0x07,0xf0,0x07,0xf0,0x07,0xf0,0x07,0xf0,0x07,0xf0,0x07,0xf0,0x0f,0xe0,0x0f,0xe0,0x1f,0xc0,0x3f,0x00,0xff,0x00,
 };
 
+const uint8_t ball_1_span_5[3*4] PROGMEM =
+{
+	0,0, 2,14,
+	1,15, 0,16,
+	0,0, 1,15,
+};
+
 const uint8_t ball_1_bmap_6[3*16*2] PROGMEM =
 {
 // Bitmap shift 6 (16+6 x 16):
@@ -1694,6 +2106,13 @@ const uint8_t ball_1_bmap_6[3*16*2] PROGMEM =
 	0x7f,0x00,0x1f,0x80,0x0f,0xe0,0x07,0xf0,0x07,0xf0,0x03,0xf8,0x03,0xf8,0x03,0xf8,0x03,0xf8,0x03,0xf8,0x03,0xf8,0x07,0xf0,0x07,0xf0,0x0f,0xe0,0x1f,0x80,0x7f,0x00,
 };
 
+const uint8_t ball_1_span_6[3*4] PROGMEM =
+{
+	0,0, 3,13,
+	2,14, 0,16,
+	0,0, 0,16,
+};
+
 const uint8_t ball_1_bmap_7[3*16*2] PROGMEM =
 {
 // Bitmap shift 7 (16+7 x 16):
@@ -1736,6 +2155,13 @@ const uint8_t ball_1_bmap_7[3*16*2] PROGMEM =
 	0x3f,0x00,0x0f,0xc0,0x07,0xf0,0x03,0xf8,0x03,0xf8,0x01,0xfc,0x01,0xfc,0x01,0xfc,0x01,0xfc,0x01,0xfc,0x01,0xfc,0x03,0x78,0x03,0xf8,0x07,0xf0,0x0f,0xc0,0x3f,0x00,
 };
 
+const uint8_t ball_1_span_7[3*4] PROGMEM =
+{
+	0,0, 5,11,
+	3,13, 0,16,
+	0,0, 0,16,
+};
+
 // #8 (0x08) - "death_star" (48 x 46)
 const uint8_t death_star_bmap_0[6*46*2] PROGMEM =
 {
@@ -1842,746 +2268,91 @@ const uint8_t death_star_bmap_0[6*46*2] PROGMEM =
 	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xc3,0x00,0x03,0x10,0x03,0xf8,0x03,0x04,0x03,0xc4,0x3b,0x84,0x7b,0x04,0xff,0x00,0xff,0x00,0xf7,0x08,0xf7,0x08,0xef,0x10,0xef,0x10,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
 };
 
-const uint8_t death_star_bmap_1[7*46*2] PROGMEM =
+const uint8_t death_star_span_0[6*4] PROGMEM =
 {
-// Bitmap shift 1 (48+1 x 46):
-// Mask bitmap (48 x 46):
-// ###################.......##############################
-// ################............############################
-// ##############...............###########################
-// #############.................##########################
-// ###########.......................######################
-// ##########.......................#######################
-// #########.......................########################
-// ########..........................######################
-// #######..........................#######################
-// ######...........................#######################
-// ######...........................#######################
-// #####...............................####################
-// #####............................#######################
-// ####................................####################
-// ####................................####################
-// ###.................................####################
-// ###.................................####################
-// ###................................#####################
-// ###...................................##################
-// ###.....................................###....#########
-// ##.............................................#########
-// ##.............................................#########
-// ##.............................................#########
-// ##.............................................#########
-// ###........................................###.#########
-// ###..................................###..####.#########
-// ####.................................###################
-// ###..................................###################
-// ###............................##############.##########
-// ####................................#########.##########
-// ####....................................####.###########
-// ####...........................#############.###########
-// #####.............................######################
-// #####..........................#########################
-// ######...........................#######################
-// #######.........................########################
-// ########........................########################
-// #########......................#########################
-// ##########...................###########################
-// ###########..................###########################
-// ############..................##########################
-// ##############..................#...####################
-// ################..................######################
-// ##################.............#########################
-// ########################################################
-// ########################################################
-// Monochrome bitmap (48+1 x 46):
-// ........................................................
-// ...................#####................................
-// ................#########...............................
-// ..............##########................................
-// .............##########........#........................
-// ...........################...###.......................
-// ..........##################.##.........................
-// .........###################..###.......................
-// ........######......########............................
-// .......######..##....#######.#..........................
-// .......#####..#####...#####.............................
-// ......#####..#.........#######.#........................
-// ......#####.##.........#######..........................
-// .....######.###.##.#...#######..........................
-// .....######.###....#...#######..........................
-// ....#######.####..###.#############.....................
-// ....########.#######..########..........................
-// ....########..#####..##########.........................
-// ....#########.......########......##....................
-// ...#############################........................
-// ...################################.....#...#...........
-// ....#################################.########..........
-// .......#############..........................#.........
-// ...########################################...#.........
-// ....############################.####...##....#.........
-// ......################.....######.............#.........
-// ........##############.#...#...###......................
-// ......##############....................................
-// ......#######.####...........................#..........
-// .......###.......#...........................#..........
-// ..................#.........................#...........
-// ............................................#...........
-// ............................#..#........................
-// ...........##..###...###................................
-// .......#...################.............................
-// ........##############..................................
-// .........###############................................
-// ..........###########...................................
-// ...........###########..................................
-// ............##########.####.............................
-// ..............#########.................................
-// ................###########.......#.....................
-// ..................###############.......................
-// .......................###..............................
-// ........................................................
-// ........................................................
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfc,0x01,0xfc,0x01,0xf8,0x03,0xf8,0x03,0xf0,0x07,0xf0,0x07,0xe0,0x0f,0xe0,0x0f,0xe0,0x0f,0xe0,0x0f,0xe0,0x1f,0xc0,0x1f,0xc0,0x0f,0xc0,0x01,0xc0,0x1f,0xe0,0x0f,0xe0,0x03,0xf0,0x00,0xe0,0x03,0xe0,0x03,0xf0,0x01,0xf0,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x01,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xfc,0x00,0xf8,0x03,0xe0,0x07,0xc0,0x1f,0x80,0x3f,0x00,0x7f,0x00,0xfc,0x00,0xf9,0x00,0xf3,0x00,0xe4,0x00,0xec,0x00,0xee,0x00,0xee,0x00,0xef,0x00,0xf7,0x00,0xf3,0x00,0xf8,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfb,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x1f,0x00,0xff,0x00,0x7f,0x80,0x3f,0xc0,0x1f,0xe0,0x0f,0xf0,0x03,0xfc,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xe0,0x00,0x00,0x1f,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x0f,0x00,0x87,0x00,0xe3,0x00,0x01,0x00,0x01,0x00,0xd1,0x00,0x11,0x00,0x3b,0x00,0xf3,0x00,0xe7,0x00,0x0f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xf0,0x00,0xff,0x00,0xff,0x00,0xfc,0x00,0xfd,0x00,0xf0,0x00,0xc0,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xc7,0x00,0xff,0x00,0xfc,0x00,0xff,0x00,0xf8,0x00,0xfc,0x00,0xfd,0x00,0xfe,0x00,0xff,0x00,0x3f,0xc0,0x01,0xff,0x00,0xff,0x00,
-	0x3f,0x00,0x0f,0x00,0x07,0x80,0x03,0x00,0x00,0x01,0x00,0xe3,0x00,0xf6,0x00,0xf3,0x00,0xf0,0x00,0xf4,0x00,0xe0,0x00,0xfd,0x00,0xfc,0x00,0xfc,0x00,0xfc,0x00,0xff,0x00,0xfc,0x00,0xfe,0x00,0xf0,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0xff,0x00,0x1f,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x09,0x01,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x01,0x00,0x07,0x00,0x07,0xe0,0x03,0x00,0x00,0xe0,0x00,0xff,0x01,0xc0,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0x00,0x7f,0x80,0xff,0x00,0x3f,0x80,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x0f,0x00,0x7f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0xe0,0x0f,0x00,0x1f,0x00,0x03,0x30,0x00,0x00,0x00,0xe0,0x00,0xfb,0x00,0x00,0x00,0xff,0x00,0x78,0x07,0x80,0x07,0xc0,0x07,0x00,0xff,0x00,0x0f,0x00,0x00,0x00,0xff,0x00,0x3f,0x00,0xff,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x8f,0x20,0x3f,0x80,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xe1,0x00,0x01,0x88,0x01,0xfc,0x01,0x02,0x01,0xe2,0x1d,0xc2,0x3d,0x02,0xff,0x00,0xff,0x00,0xfb,0x04,0xfb,0x04,0xf7,0x08,0xf7,0x08,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-};
-
-const uint8_t death_star_bmap_2[7*46*2] PROGMEM =
-{
-// Bitmap shift 2 (48+2 x 46):
-// Mask bitmap (48 x 46):
-// ####################.......#############################
-// #################............###########################
-// ###############...............##########################
-// ##############.................#########################
-// ############.......................#####################
-// ###########.......................######################
-// ##########.......................#######################
-// #########..........................#####################
-// ########..........................######################
-// #######...........................######################
-// #######...........................######################
-// ######...............................###################
-// ######............................######################
-// #####................................###################
-// #####................................###################
-// ####.................................###################
-// ####.................................###################
-// ####................................####################
-// ####...................................#################
-// ####.....................................###....########
-// ###.............................................########
-// ###.............................................########
-// ###.............................................########
-// ###.............................................########
-// ####........................................###.########
-// ####..................................###..####.########
-// #####.................................##################
-// ####..................................##################
-// ####............................##############.#########
-// #####................................#########.#########
-// #####....................................####.##########
-// #####...........................#############.##########
-// ######.............................#####################
-// ######..........................########################
-// #######...........................######################
-// ########.........................#######################
-// #########........................#######################
-// ##########......................########################
-// ###########...................##########################
-// ############..................##########################
-// #############..................#########################
-// ###############..................#...###################
-// #################..................#####################
-// ###################.............########################
-// ########################################################
-// ########################################################
-// Monochrome bitmap (48+2 x 46):
-// ........................................................
-// ....................#####...............................
-// .................#########..............................
-// ...............##########...............................
-// ..............##########........#.......................
-// ............################...###......................
-// ...........##################.##........................
-// ..........###################..###......................
-// .........######......########...........................
-// ........######..##....#######.#.........................
-// ........#####..#####...#####............................
-// .......#####..#.........#######.#.......................
-// .......#####.##.........#######.........................
-// ......######.###.##.#...#######.........................
-// ......######.###....#...#######.........................
-// .....#######.####..###.#############....................
-// .....########.#######..########.........................
-// .....########..#####..##########........................
-// .....#########.......########......##...................
-// ....#############################.......................
-// ....################################.....#...#..........
-// .....#################################.########.........
-// ........#############..........................#........
-// ....########################################...#........
-// .....############################.####...##....#........
-// .......################.....######.............#........
-// .........##############.#...#...###.....................
-// .......##############...................................
-// .......#######.####...........................#.........
-// ........###.......#...........................#.........
-// ...................#.........................#..........
-// .............................................#..........
-// .............................#..#.......................
-// ............##..###...###...............................
-// ........#...################............................
-// .........##############.................................
-// ..........###############...............................
-// ...........###########..................................
-// ............###########.................................
-// .............##########.####............................
-// ...............#########................................
-// .................###########.......#....................
-// ...................###############......................
-// ........................###.............................
-// ........................................................
-// ........................................................
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfe,0x00,0xfc,0x01,0xfc,0x01,0xf8,0x03,0xf8,0x03,0xf0,0x07,0xf0,0x07,0xf0,0x07,0xf0,0x07,0xf0,0x0f,0xe0,0x0f,0xe0,0x07,0xe0,0x00,0xe0,0x0f,0xf0,0x07,0xf0,0x01,0xf8,0x00,0xf0,0x01,0xf0,0x01,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x00,0xfc,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xfe,0x00,0xfc,0x01,0xf0,0x03,0xe0,0x0f,0xc0,0x1f,0x80,0x3f,0x00,0x7e,0x00,0xfc,0x00,0xf9,0x00,0xf2,0x00,0xf6,0x00,0xf7,0x00,0xf7,0x00,0xf7,0x00,0xfb,0x00,0xf9,0x00,0xfc,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0xff,0x00,0xfd,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x8f,0x00,0x7f,0x80,0x3f,0xc0,0x1f,0xe0,0x0f,0xf0,0x07,0xf8,0x01,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xf0,0x00,0x80,0x0f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x07,0x00,0xc3,0x00,0xf1,0x00,0x00,0x00,0x00,0x00,0x68,0x00,0x08,0x00,0x9d,0x00,0xf9,0x00,0xf3,0x00,0x07,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xf8,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfe,0x00,0xf8,0x00,0xe0,0x00,0x20,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xe3,0x00,0xff,0x00,0xfe,0x00,0xff,0x00,0xfc,0x00,0xfe,0x00,0xfe,0x00,0xff,0x00,0x7f,0x80,0x1f,0xe0,0x00,0xff,0x00,0xff,0x00,
-	0x1f,0x00,0x07,0x80,0x03,0xc0,0x01,0x80,0x00,0x00,0x00,0xf1,0x00,0xfb,0x00,0xf9,0x00,0xf8,0x00,0xfa,0x00,0xf0,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xff,0x00,0xfe,0x00,0xff,0x00,0xf8,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0xff,0x00,0x0f,0x00,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0xf0,0x00,0x00,0x00,0x80,0x00,0x00,0x03,0x00,0x03,0xf0,0x01,0x00,0x00,0xf0,0x00,0xff,0x00,0xe0,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x1f,0x80,0x3f,0xc0,0x7f,0x00,0x1f,0xc0,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x07,0x80,0x3f,0x00,0x07,0x00,0x07,0x00,0x07,0xf0,0x07,0x00,0x0f,0x00,0x01,0x18,0x00,0x80,0x00,0xf0,0x00,0xfd,0x00,0x00,0x00,0xff,0x00,0xbc,0x03,0xc0,0x03,0xe0,0x03,0x00,0xff,0x00,0x07,0x00,0x00,0x00,0xff,0x00,0x1f,0x80,0xff,0x00,0x3f,0x00,0x7f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x47,0x10,0x1f,0xc0,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x70,0x00,0x00,0x44,0x00,0xfe,0x00,0x01,0x00,0xf1,0x0e,0x61,0x9e,0x01,0xff,0x00,0xff,0x00,0xfd,0x02,0xfd,0x02,0x7b,0x04,0xfb,0x04,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-};
-
-const uint8_t death_star_bmap_3[7*46*2] PROGMEM =
-{
-// Bitmap shift 3 (48+3 x 46):
-// Mask bitmap (48 x 46):
-// #####################.......############################
-// ##################............##########################
-// ################...............#########################
-// ###############.................########################
-// #############.......................####################
-// ############.......................#####################
-// ###########.......................######################
-// ##########..........................####################
-// #########..........................#####################
-// ########...........................#####################
-// ########...........................#####################
-// #######...............................##################
-// #######............................#####################
-// ######................................##################
-// ######................................##################
-// #####.................................##################
-// #####.................................##################
-// #####................................###################
-// #####...................................################
-// #####.....................................###....#######
-// ####.............................................#######
-// ####.............................................#######
-// ####.............................................#######
-// ####.............................................#######
-// #####........................................###.#######
-// #####..................................###..####.#######
-// ######.................................#################
-// #####..................................#################
-// #####............................##############.########
-// ######................................#########.########
-// ######....................................####.#########
-// ######...........................#############.#########
-// #######.............................####################
-// #######..........................#######################
-// ########...........................#####################
-// #########.........................######################
-// ##########........................######################
-// ###########......................#######################
-// ############...................#########################
-// #############..................#########################
-// ##############..................########################
-// ################..................#...##################
-// ##################..................####################
-// ####################.............#######################
-// ########################################################
-// ########################################################
-// Monochrome bitmap (48+3 x 46):
-// ........................................................
-// .....................#####..............................
-// ..................#########.............................
-// ................##########..............................
-// ...............##########........#......................
-// .............################...###.....................
-// ............##################.##.......................
-// ...........###################..###.....................
-// ..........######......########..........................
-// .........######..##....#######.#........................
-// .........#####..#####...#####...........................
-// ........#####..#.........#######.#......................
-// ........#####.##.........#######........................
-// .......######.###.##.#...#######........................
-// .......######.###....#...#######........................
-// ......#######.####..###.#############...................
-// ......########.#######..########........................
-// ......########..#####..##########.......................
-// ......#########.......########......##..................
-// .....#############################......................
-// .....################################.....#...#.........
-// ......#################################.########........
-// .........#############..........................#.......
-// .....########################################...#.......
-// ......############################.####...##....#.......
-// ........################.....######.............#.......
-// ..........##############.#...#...###....................
-// ........##############..................................
-// ........#######.####...........................#........
-// .........###.......#...........................#........
-// ....................#.........................#.........
-// ..............................................#.........
-// ..............................#..#......................
-// .............##..###...###..............................
-// .........#...################...........................
-// ..........##############................................
-// ...........###############..............................
-// ............###########.................................
-// .............###########................................
-// ..............##########.####...........................
-// ................#########...............................
-// ..................###########.......#...................
-// ....................###############.....................
-// .........................###............................
-// ........................................................
-// ........................................................
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfe,0x00,0xfc,0x01,0xfc,0x01,0xf8,0x03,0xf8,0x03,0xf8,0x03,0xf8,0x03,0xf8,0x07,0xf0,0x07,0xf0,0x03,0xf0,0x00,0xf0,0x07,0xf8,0x03,0xf8,0x00,0xfc,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x00,0xfc,0x00,0xfc,0x00,0xfe,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xf8,0x01,0xf0,0x07,0xe0,0x0f,0xc0,0x1f,0x80,0x3f,0x00,0x7e,0x00,0x7c,0x00,0xf9,0x00,0xfb,0x00,0xfb,0x00,0xfb,0x00,0xfb,0x00,0xfd,0x00,0xfc,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0x00,0xff,0x00,0xfe,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x47,0x80,0x3f,0xc0,0x1f,0xe0,0x0f,0xf0,0x07,0xf8,0x03,0xfc,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xf8,0x00,0xc0,0x07,0x00,0x3f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x03,0x00,0x61,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0xb4,0x00,0x84,0x00,0xce,0x00,0xfc,0x00,0xf9,0x00,0x03,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfc,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfc,0x00,0xf0,0x00,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x71,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0xc0,0x0f,0xf0,0x00,0xff,0x00,0xff,0x00,
-	0x0f,0x00,0x03,0xc0,0x01,0xe0,0x00,0xc0,0x00,0x80,0x00,0xf8,0x00,0xfd,0x00,0xfc,0x00,0xfc,0x00,0xfd,0x00,0xf8,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfc,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0xff,0x00,0x07,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0xc0,0x00,0xf8,0x00,0x00,0x00,0xc0,0x00,0x00,0x01,0x00,0x01,0x78,0x00,0x80,0x00,0xf8,0x00,0xff,0x00,0x70,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x0f,0x40,0x1f,0xe0,0x3f,0x80,0x0f,0xe0,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x03,0x40,0x1f,0x00,0x03,0x00,0x03,0x00,0x03,0xf8,0x03,0x00,0x07,0x80,0x00,0x0c,0x00,0xc0,0x00,0xf8,0x00,0xfe,0x00,0x00,0x00,0xff,0x00,0xde,0x01,0xe0,0x01,0x70,0x01,0x00,0x7f,0x00,0x03,0x00,0x00,0x00,0x7f,0x00,0x0f,0x40,0x7f,0x00,0x1f,0x00,0x3f,0x00,0x3f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x23,0x08,0x0f,0xe0,0x7f,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x38,0x00,0x00,0x22,0x00,0xff,0x00,0x00,0x00,0xf8,0x07,0x30,0xcf,0x00,0xff,0x00,0xff,0x00,0xfe,0x01,0xfe,0x01,0x3d,0x02,0xfd,0x02,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x80,0x7f,0x80,0x7f,0x80,0x7f,0x80,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-};
-
-const uint8_t death_star_bmap_4[7*46*2] PROGMEM =
-{
-// Bitmap shift 4 (48+4 x 46):
-// Mask bitmap (48 x 46):
-// ######################.......###########################
-// ###################............#########################
-// #################...............########################
-// ################.................#######################
-// ##############.......................###################
-// #############.......................####################
-// ############.......................#####################
-// ###########..........................###################
-// ##########..........................####################
-// #########...........................####################
-// #########...........................####################
-// ########...............................#################
-// ########............................####################
-// #######................................#################
-// #######................................#################
-// ######.................................#################
-// ######.................................#################
-// ######................................##################
-// ######...................................###############
-// ######.....................................###....######
-// #####.............................................######
-// #####.............................................######
-// #####.............................................######
-// #####.............................................######
-// ######........................................###.######
-// ######..................................###..####.######
-// #######.................................################
-// ######..................................################
-// ######............................##############.#######
-// #######................................#########.#######
-// #######....................................####.########
-// #######...........................#############.########
-// ########.............................###################
-// ########..........................######################
-// #########...........................####################
-// ##########.........................#####################
-// ###########........................#####################
-// ############......................######################
-// #############...................########################
-// ##############..................########################
-// ###############..................#######################
-// #################..................#...#################
-// ###################..................###################
-// #####################.............######################
-// ########################################################
-// ########################################################
-// Monochrome bitmap (48+4 x 46):
-// ........................................................
-// ......................#####.............................
-// ...................#########............................
-// .................##########.............................
-// ................##########........#.....................
-// ..............################...###....................
-// .............##################.##......................
-// ............###################..###....................
-// ...........######......########.........................
-// ..........######..##....#######.#.......................
-// ..........#####..#####...#####..........................
-// .........#####..#.........#######.#.....................
-// .........#####.##.........#######.......................
-// ........######.###.##.#...#######.......................
-// ........######.###....#...#######.......................
-// .......#######.####..###.#############..................
-// .......########.#######..########.......................
-// .......########..#####..##########......................
-// .......#########.......########......##.................
-// ......#############################.....................
-// ......################################.....#...#........
-// .......#################################.########.......
-// ..........#############..........................#......
-// ......########################################...#......
-// .......############################.####...##....#......
-// .........################.....######.............#......
-// ...........##############.#...#...###...................
-// .........##############.................................
-// .........#######.####...........................#.......
-// ..........###.......#...........................#.......
-// .....................#.........................#........
-// ...............................................#........
-// ...............................#..#.....................
-// ..............##..###...###.............................
-// ..........#...################..........................
-// ...........##############...............................
-// ............###############.............................
-// .............###########................................
-// ..............###########...............................
-// ...............##########.####..........................
-// .................#########..............................
-// ...................###########.......#..................
-// .....................###############....................
-// ..........................###...........................
-// ........................................................
-// ........................................................
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfe,0x00,0xfc,0x01,0xfc,0x01,0xfc,0x01,0xfc,0x01,0xfc,0x03,0xf8,0x03,0xf8,0x01,0xf8,0x00,0xf8,0x03,0xfc,0x01,0xfc,0x00,0xfe,0x00,0xfc,0x00,0xfc,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfc,0x00,0xf8,0x03,0xf0,0x07,0xe0,0x0f,0xc0,0x1f,0x80,0x3f,0x80,0x3e,0x00,0x7c,0x00,0x7d,0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,0xfe,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x1f,0x00,0x7f,0x00,0x7f,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x23,0xc0,0x1f,0xe0,0x0f,0xf0,0x07,0xf8,0x03,0xfc,0x01,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xfc,0x00,0xe0,0x03,0x80,0x1f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x81,0x00,0x30,0x00,0x7c,0x00,0x80,0x00,0x80,0x00,0xda,0x00,0xc2,0x00,0xe7,0x00,0xfe,0x00,0x7c,0x00,0x01,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0x78,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x80,0x1f,0xe0,0x07,0xf8,0x00,0xff,0x00,0xff,0x00,
-	0x07,0x00,0x01,0xe0,0x00,0xf0,0x00,0xe0,0x00,0xc0,0x00,0xfc,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0x7c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x7f,0x00,0x7f,0x00,0xff,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0xff,0x00,0x83,0x00,0xa2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0xe0,0x00,0xfc,0x00,0x80,0x00,0xe0,0x00,0x00,0x00,0x80,0x00,0xbc,0x00,0xc0,0x00,0xfc,0x00,0xff,0x00,0x38,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x07,0x20,0x0f,0x70,0x1f,0xc0,0x07,0x70,0x0f,0x00,0x0f,0x80,0x0f,0x00,0x01,0xa0,0x0f,0x80,0x01,0x80,0x01,0x80,0x01,0xfc,0x01,0x80,0x03,0xc0,0x00,0x06,0x00,0xe0,0x00,0xfc,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0xef,0x00,0xf0,0x00,0x38,0x00,0x00,0x3f,0x00,0x01,0x00,0x00,0x00,0x3f,0x00,0x07,0x20,0x3f,0x00,0x0f,0x00,0x1f,0x00,0x1f,0x00,0x3f,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x11,0x04,0x07,0xf0,0x3f,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x1c,0x00,0x00,0x11,0x00,0x7f,0x00,0x00,0x00,0xfc,0x03,0x18,0xe7,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x1e,0x01,0xfe,0x01,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x80,0x3f,0x40,0x3f,0x40,0xbf,0x40,0xbf,0x40,0xff,0x00,0xff,0x00,0x7f,0x80,0x7f,0x80,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-};
-
-const uint8_t death_star_bmap_5[7*46*2] PROGMEM =
-{
-// Bitmap shift 5 (48+5 x 46):
-// Mask bitmap (48 x 46):
-// #######################.......##########################
-// ####################............########################
-// ##################...............#######################
-// #################.................######################
-// ###############.......................##################
-// ##############.......................###################
-// #############.......................####################
-// ############..........................##################
-// ###########..........................###################
-// ##########...........................###################
-// ##########...........................###################
-// #########...............................################
-// #########............................###################
-// ########................................################
-// ########................................################
-// #######.................................################
-// #######.................................################
-// #######................................#################
-// #######...................................##############
-// #######.....................................###....#####
-// ######.............................................#####
-// ######.............................................#####
-// ######.............................................#####
-// ######.............................................#####
-// #######........................................###.#####
-// #######..................................###..####.#####
-// ########.................................###############
-// #######..................................###############
-// #######............................##############.######
-// ########................................#########.######
-// ########....................................####.#######
-// ########...........................#############.#######
-// #########.............................##################
-// #########..........................#####################
-// ##########...........................###################
-// ###########.........................####################
-// ############........................####################
-// #############......................#####################
-// ##############...................#######################
-// ###############..................#######################
-// ################..................######################
-// ##################..................#...################
-// ####################..................##################
-// ######################.............#####################
-// ########################################################
-// ########################################################
-// Monochrome bitmap (48+5 x 46):
-// ........................................................
-// .......................#####............................
-// ....................#########...........................
-// ..................##########............................
-// .................##########........#....................
-// ...............################...###...................
-// ..............##################.##.....................
-// .............###################..###...................
-// ............######......########........................
-// ...........######..##....#######.#......................
-// ...........#####..#####...#####.........................
-// ..........#####..#.........#######.#....................
-// ..........#####.##.........#######......................
-// .........######.###.##.#...#######......................
-// .........######.###....#...#######......................
-// ........#######.####..###.#############.................
-// ........########.#######..########......................
-// ........########..#####..##########.....................
-// ........#########.......########......##................
-// .......#############################....................
-// .......################################.....#...#.......
-// ........#################################.########......
-// ...........#############..........................#.....
-// .......########################################...#.....
-// ........############################.####...##....#.....
-// ..........################.....######.............#.....
-// ............##############.#...#...###..................
-// ..........##############................................
-// ..........#######.####...........................#......
-// ...........###.......#...........................#......
-// ......................#.........................#.......
-// ................................................#.......
-// ................................#..#....................
-// ...............##..###...###............................
-// ...........#...################.........................
-// ............##############..............................
-// .............###############............................
-// ..............###########...............................
-// ...............###########..............................
-// ................##########.####.........................
-// ..................#########.............................
-// ....................###########.......#.................
-// ......................###############...................
-// ...........................###..........................
-// ........................................................
-// ........................................................
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x01,0xfc,0x01,0xfc,0x00,0xfc,0x00,0xfc,0x01,0xfe,0x00,0xfe,0x00,0xff,0x00,0xfe,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfc,0x01,0xf8,0x03,0xf0,0x07,0xe0,0x0f,0xc0,0x1f,0xc0,0x1f,0x80,0x3e,0x80,0x3e,0x00,0x7e,0x00,0x7e,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x1f,0x00,0xff,0x00,0xff,0x00,0x3f,0x00,0x0f,0x00,0x3f,0x00,0x3f,0x00,0x1c,0x00,0x00,0x00,0x00,0x80,0x00,0x80,0x01,0xc0,0x11,0xe0,0x0f,0xf0,0x07,0xf8,0x03,0xfc,0x01,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xfe,0x00,0xf0,0x01,0xc0,0x0f,0x80,0x3f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xc0,0x00,0x98,0x00,0x3e,0x00,0x40,0x00,0xc0,0x00,0xed,0x00,0xe1,0x00,0xf3,0x00,0x7f,0x00,0x3e,0x00,0x80,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xbc,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x9c,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0xc0,0x0f,0xf0,0x03,0xfc,0x00,0xff,0x00,0xff,0x00,
-	0x03,0x00,0x00,0xf0,0x00,0xf8,0x00,0xf0,0x00,0xe0,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x3e,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xbf,0x00,0x3f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0xff,0x00,0xc1,0x00,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0xfe,0x00,0xc0,0x00,0xf0,0x00,0x80,0x00,0xc0,0x00,0xde,0x00,0xe0,0x00,0xfe,0x00,0xff,0x00,0x1c,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0x7f,0x00,0x3f,0x00,0x03,0x10,0x07,0x38,0x0f,0x60,0x03,0x38,0x07,0x00,0x07,0x40,0x07,0x00,0x00,0xd0,0x07,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xfe,0x00,0xc0,0x01,0xe0,0x00,0x03,0x00,0xf0,0x00,0xfe,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0xf7,0x00,0xf8,0x00,0x1c,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x03,0x90,0x1f,0x00,0x07,0x00,0x0f,0x00,0x0f,0x00,0x1f,0x00,0x7f,0x00,0x7f,0x00,0x3f,0x00,0x08,0x02,0x03,0xf8,0x1f,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0x00,0x0e,0x00,0x00,0x08,0x00,0xbf,0x00,0x00,0x00,0xfe,0x01,0x8c,0x73,0x00,0x7f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0x0f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x1f,0x00,0x1f,0x80,0x1f,0xc0,0x1f,0x20,0x1f,0x20,0xdf,0x20,0xdf,0x20,0xff,0x00,0xff,0x00,0xbf,0x40,0xbf,0x40,0x7f,0x80,0x7f,0x80,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-};
-
-const uint8_t death_star_bmap_6[7*46*2] PROGMEM =
-{
-// Bitmap shift 6 (48+6 x 46):
-// Mask bitmap (48 x 46):
-// ########################.......#########################
-// #####################............#######################
-// ###################...............######################
-// ##################.................#####################
-// ################.......................#################
-// ###############.......................##################
-// ##############.......................###################
-// #############..........................#################
-// ############..........................##################
-// ###########...........................##################
-// ###########...........................##################
-// ##########...............................###############
-// ##########............................##################
-// #########................................###############
-// #########................................###############
-// ########.................................###############
-// ########.................................###############
-// ########................................################
-// ########...................................#############
-// ########.....................................###....####
-// #######.............................................####
-// #######.............................................####
-// #######.............................................####
-// #######.............................................####
-// ########........................................###.####
-// ########..................................###..####.####
-// #########.................................##############
-// ########..................................##############
-// ########............................##############.#####
-// #########................................#########.#####
-// #########....................................####.######
-// #########...........................#############.######
-// ##########.............................#################
-// ##########..........................####################
-// ###########...........................##################
-// ############.........................###################
-// #############........................###################
-// ##############......................####################
-// ###############...................######################
-// ################..................######################
-// #################..................#####################
-// ###################..................#...###############
-// #####################..................#################
-// #######################.............####################
-// ########################################################
-// ########################################################
-// Monochrome bitmap (48+6 x 46):
-// ........................................................
-// ........................#####...........................
-// .....................#########..........................
-// ...................##########...........................
-// ..................##########........#...................
-// ................################...###..................
-// ...............##################.##....................
-// ..............###################..###..................
-// .............######......########.......................
-// ............######..##....#######.#.....................
-// ............#####..#####...#####........................
-// ...........#####..#.........#######.#...................
-// ...........#####.##.........#######.....................
-// ..........######.###.##.#...#######.....................
-// ..........######.###....#...#######.....................
-// .........#######.####..###.#############................
-// .........########.#######..########.....................
-// .........########..#####..##########....................
-// .........#########.......########......##...............
-// ........#############################...................
-// ........################################.....#...#......
-// .........#################################.########.....
-// ............#############..........................#....
-// ........########################################...#....
-// .........############################.####...##....#....
-// ...........################.....######.............#....
-// .............##############.#...#...###.................
-// ...........##############...............................
-// ...........#######.####...........................#.....
-// ............###.......#...........................#.....
-// .......................#.........................#......
-// .................................................#......
-// .................................#..#...................
-// ................##..###...###...........................
-// ............#...################........................
-// .............##############.............................
-// ..............###############...........................
-// ...............###########..............................
-// ................###########.............................
-// .................##########.####........................
-// ...................#########............................
-// .....................###########.......#................
-// .......................###############..................
-// ............................###.........................
-// ........................................................
-// ........................................................
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfc,0x01,0xf8,0x03,0xf0,0x07,0xe0,0x0f,0xe0,0x0f,0xc0,0x1f,0xc0,0x1f,0x80,0x3f,0x80,0x3f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x0f,0x00,0xff,0x00,0x7f,0x00,0x1f,0x80,0x07,0x00,0x1f,0x00,0x1f,0x80,0x0e,0x80,0x00,0x80,0x00,0xc0,0x00,0xc0,0x00,0xe0,0x08,0xf0,0x07,0xf8,0x03,0xfc,0x01,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xf8,0x00,0xe0,0x07,0xc0,0x1f,0x00,0x3f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xe0,0x00,0xcc,0x00,0x9f,0x00,0x20,0x00,0x60,0x00,0x76,0x00,0x70,0x00,0x79,0x00,0xbf,0x00,0x9f,0x00,0xc0,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xde,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0xce,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x80,0x1f,0xe0,0x07,0xf8,0x01,0xfe,0x00,0xff,0x00,0xff,0x00,
-	0x01,0x00,0x00,0xf8,0x00,0xfc,0x00,0xf8,0x00,0xf0,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0x3f,0x00,0x1f,0x00,0x0f,0x00,0x0f,0x00,0x8f,0x00,0x8f,0x00,0xdf,0x00,0x9f,0x00,0x3f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x80,0x00,0xff,0x00,0xff,0x00,0xe0,0x00,0xe8,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0xff,0x00,0xe0,0x00,0xf8,0x00,0xc0,0x00,0xe0,0x00,0xef,0x00,0xf0,0x00,0xff,0x00,0xff,0x00,0x0e,0xff,0x00,0xff,0x00,
-	0xff,0x00,0x7f,0x00,0x3f,0x00,0x1f,0x00,0x01,0x08,0x03,0x1c,0x07,0xb0,0x01,0x9c,0x03,0x80,0x03,0xa0,0x03,0x00,0x00,0xe8,0x03,0xe0,0x00,0xe0,0x00,0xe0,0x00,0xff,0x00,0xe0,0x00,0xf0,0x00,0x81,0x00,0xf8,0x00,0xff,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0xfb,0x00,0xfc,0x00,0x8e,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x01,0x48,0x0f,0x00,0x03,0x00,0x07,0x00,0x07,0x00,0x0f,0x00,0x3f,0x00,0x3f,0x00,0x1f,0x00,0x04,0x01,0x01,0xfc,0x0f,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0xff,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0xff,0x00,0x1f,0x80,0x07,0x00,0x00,0x04,0x00,0xdf,0x00,0x00,0x00,0xff,0x00,0xc6,0x39,0x00,0x3f,0x00,0x3f,0x00,0xff,0x00,0x7f,0x00,0x07,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x0f,0x00,0x0f,0x40,0x0f,0xe0,0x0f,0x10,0x0f,0x10,0xef,0x10,0xef,0x10,0xff,0x00,0xff,0x00,0xdf,0x20,0xdf,0x20,0xbf,0x40,0xbf,0x40,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-};
-
-const uint8_t death_star_bmap_7[7*46*2] PROGMEM =
-{
-// Bitmap shift 7 (48+7 x 46):
-// Mask bitmap (48 x 46):
-// #########################.......########################
-// ######################............######################
-// ####################...............#####################
-// ###################.................####################
-// #################.......................################
-// ################.......................#################
-// ###############.......................##################
-// ##############..........................################
-// #############..........................#################
-// ############...........................#################
-// ############...........................#################
-// ###########...............................##############
-// ###########............................#################
-// ##########................................##############
-// ##########................................##############
-// #########.................................##############
-// #########.................................##############
-// #########................................###############
-// #########...................................############
-// #########.....................................###....###
-// ########.............................................###
-// ########.............................................###
-// ########.............................................###
-// ########.............................................###
-// #########........................................###.###
-// #########..................................###..####.###
-// ##########.................................#############
-// #########..................................#############
-// #########............................##############.####
-// ##########................................#########.####
-// ##########....................................####.#####
-// ##########...........................#############.#####
-// ###########.............................################
-// ###########..........................###################
-// ############...........................#################
-// #############.........................##################
-// ##############........................##################
-// ###############......................###################
-// ################...................#####################
-// #################..................#####################
-// ##################..................####################
-// ####################..................#...##############
-// ######################..................################
-// ########################.............###################
-// ########################################################
-// ########################################################
-// Monochrome bitmap (48+7 x 46):
-// ........................................................
-// .........................#####..........................
-// ......................#########.........................
-// ....................##########..........................
-// ...................##########........#..................
-// .................################...###.................
-// ................##################.##...................
-// ...............###################..###.................
-// ..............######......########......................
-// .............######..##....#######.#....................
-// .............#####..#####...#####.......................
-// ............#####..#.........#######.#..................
-// ............#####.##.........#######....................
-// ...........######.###.##.#...#######....................
-// ...........######.###....#...#######....................
-// ..........#######.####..###.#############...............
-// ..........########.#######..########....................
-// ..........########..#####..##########...................
-// ..........#########.......########......##..............
-// .........#############################..................
-// .........################################.....#...#.....
-// ..........#################################.########....
-// .............#############..........................#...
-// .........########################################...#...
-// ..........############################.####...##....#...
-// ............################.....######.............#...
-// ..............##############.#...#...###................
-// ............##############..............................
-// ............#######.####...........................#....
-// .............###.......#...........................#....
-// ........................#.........................#.....
-// ..................................................#.....
-// ..................................#..#..................
-// .................##..###...###..........................
-// .............#...################.......................
-// ..............##############............................
-// ...............###############..........................
-// ................###########.............................
-// .................###########............................
-// ..................##########.####.......................
-// ....................#########...........................
-// ......................###########.......#...............
-// ........................###############.................
-// .............................###........................
-// ........................................................
-// ........................................................
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xfe,0x00,0xfc,0x01,0xf8,0x03,0xf0,0x07,0xf0,0x07,0xe0,0x0f,0xe0,0x0f,0xc0,0x1f,0xc0,0x1f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x3f,0x80,0x7f,0x00,0x7f,0x00,0x3f,0x00,0x07,0x00,0x7f,0x80,0x3f,0x80,0x0f,0xc0,0x03,0x80,0x0f,0x80,0x0f,0xc0,0x07,0xc0,0x00,0xc0,0x00,0xe0,0x00,0xe0,0x00,0xf0,0x04,0xf8,0x03,0xfc,0x01,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xfc,0x00,0xf0,0x03,0xe0,0x0f,0x80,0x1f,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xf0,0x00,0xe6,0x00,0xcf,0x00,0x90,0x00,0xb0,0x00,0xbb,0x00,0xb8,0x00,0xbc,0x00,0xdf,0x00,0xcf,0x00,0xe0,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xef,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x00,0x7f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x7f,0x80,0x3f,0xc0,0x0f,0xf0,0x03,0xfc,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0x80,0x00,0x00,0x7c,0x00,0xfe,0x00,0xfc,0x00,0xf8,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0x00,0x1f,0x00,0x8f,0x00,0x07,0x00,0x07,0x00,0x47,0x00,0x47,0x00,0xef,0x00,0xcf,0x00,0x9f,0x00,0x3f,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xc0,0x00,0xff,0x00,0xff,0x00,0xf0,0x00,0xf4,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xff,0x00,0xf0,0x00,0xfc,0x00,0xe0,0x00,0xf0,0x00,0xf7,0x00,0xf8,0x00,0xff,0x00,0xff,0x00,0x07,0xff,0x00,0xff,0x00,
-	0xff,0x00,0x3f,0x00,0x1f,0x00,0x0f,0x00,0x00,0x04,0x01,0x8e,0x03,0xd8,0x00,0xce,0x01,0xc0,0x01,0xd0,0x01,0x80,0x00,0xf4,0x01,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xff,0x00,0xf0,0x00,0xf8,0x00,0xc0,0x00,0xfc,0x00,0xff,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0xfd,0x00,0x7e,0x00,0x47,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x24,0x07,0x00,0x01,0x80,0x03,0x00,0x03,0x00,0x07,0x00,0x1f,0x00,0x1f,0x80,0x0f,0x00,0x02,0x80,0x00,0xfe,0x07,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0x00,0xff,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x80,0x3f,0x00,0x7f,0x00,0x0f,0xc0,0x03,0x00,0x00,0x82,0x00,0xef,0x00,0x00,0x00,0xff,0x00,0xe3,0x1c,0x00,0x1f,0x00,0x1f,0x00,0xff,0x00,0x3f,0x00,0x03,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x3f,0x80,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
-	0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0x87,0x00,0x07,0x20,0x07,0xf0,0x07,0x08,0x07,0x88,0x77,0x08,0xf7,0x08,0xff,0x00,0xff,0x00,0xef,0x10,0xef,0x10,0xdf,0x20,0xdf,0x20,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,0xff,0x00,
+	0,0, 7,37,
+	6,38, 1,43,
+	1,43, 0,44,
+	7,28, 0,44,
+	20,25, 4,43,
+	0,0, 19,32,
+};
+
+const uint8_t death_star_span_1[7*4] PROGMEM =
+{
+	0,0, 8,36,
+	7,37, 2,42,
+	1,43, 0,44,
+	4,28, 0,44,
+	19,25, 4,43,
+	0,0, 19,32,
+	0,0, 0,0,
+};
+
+const uint8_t death_star_span_2[7*4] PROGMEM =
+{
+	0,0, 9,35,
+	8,36, 2,42,
+	2,42, 0,44,
+	4,38, 0,44,
+	19,25, 4,43,
+	20,24, 19,32,
+	0,0, 0,0,
+};
+
+const uint8_t death_star_span_3[7*4] PROGMEM =
+{
+	0,0, 11,34,
+	9,35, 3,41,
+	2,42, 0,44,
+	3,38, 0,44,
+	18,25, 4,44,
+	20,24, 19,32,
+	0,0, 19,26,
+};
+
+const uint8_t death_star_span_4[7*4] PROGMEM =
+{
+	0,0, 13,32,
+	11,34, 4,41,
+	3,41, 0,44,
+	2,44, 0,44,
+	18,28, 3,44,
+	20,24, 18,32,
+	0,0, 19,30,
+};
+
+const uint8_t death_star_span_5[7*4] PROGMEM =
+{
+	0,0, 15,29,
+	13,32, 4,40,
+	4,41, 0,44,
+	1,44, 0,44,
+	18,28, 2,44,
+	20,24, 18,31,
+	0,0, 19,32,
+};
+
+const uint8_t death_star_span_6[7*4] PROGMEM =
+{
+	0,0, 20,24,
+	15,26, 5,39,
+	4,40, 1,44,
+	1,44, 0,44,
+	13,28, 1,44,
+	20,25, 11,42,
+	0,0, 19,32,
+};
+
+const uint8_t death_star_span_7[7*4] PROGMEM =
+{
+	0,0, 0,0,
+	20,24, 6,38,
+	5,39, 1,43,
+	1,44, 0,44,
+	13,28, 1,44,
+	20,25, 11,42,
+	0,0, 19,32,
 };
 
 const sprite_rom sprite_def[10] PROGMEM =
@@ -2598,6 +2369,16 @@ const sprite_rom sprite_def[10] PROGMEM =
 			square_bmap_6,
 			square_bmap_7,
 		},
+		{
+			square_span_0,
+			square_span_1,
+			square_span_2,
+			square_span_3,
+			square_span_4,
+			square_span_5,
+			square_span_6,
+			square_span_7,
+		},
 	},
 	{
 		16, 16,	// #1 "smiley_test"
@@ -2611,6 +2392,16 @@ const sprite_rom sprite_def[10] PROGMEM =
 			smiley_test_bmap_6,
 			smiley_test_bmap_7,
 		},
+		{
+			smiley_test_span_0,
+			smiley_test_span_1,
+			smiley_test_span_2,
+			smiley_test_span_3,
+			smiley_test_span_4,
+			smiley_test_span_5,
+			smiley_test_span_6,
+			smiley_test_span_7,
+		},
 	},
 	{
 		1, 1,	// #2 "pixel"
@@ -2624,6 +2415,16 @@ const sprite_rom sprite_def[10] PROGMEM =
 			pixel_bmap_6,
 			pixel_bmap_7,
 		},
+		{
+			pixel_span_0,
+			pixel_span_1,
+			pixel_span_2,
+			pixel_span_3,
+			pixel_span_4,
+			pixel_span_5,
+			pixel_span_6,
+			pixel_span_7,
+		},
 	},
 	{
 		2, 1,	// #3 "pixel2"
@@ -2637,6 +2438,16 @@ const sprite_rom sprite_def[10] PROGMEM =
 			pixel2_bmap_6,
 			pixel2_bmap_7,
 		},
+		{
+			pixel2_span_0,
+			pixel2_span_1,
+			pixel2_span_2,
+			pixel2_span_3,
+			pixel2_span_4,
+			pixel2_span_5,
+			pixel2_span_6,
+			pixel2_span_7,
+		},
 	},
 	{
 		7, 1,	// #4 "pixel7"
@@ -2650,6 +2461,16 @@ const sprite_rom sprite_def[10] PROGMEM =
 			pixel7_bmap_6,
 			pixel7_bmap_7,
 		},
+		{
+			pixel7_span_0,
+			pixel7_span_1,
+			pixel7_span_2,
+			pixel7_span_3,
+			pixel7_span_4,
+			pixel7_span_5,
+			pixel7_span_6,
+			pixel7_span_7,
+		},
 	},
 	{
 		30, 8,	// #5 "XOR_test"
@@ -2663,6 +2484,16 @@ const sprite_rom sprite_def[10] PROGMEM =
 			XOR_test_bmap_6,
 			XOR_test_bmap_7,
 		},
+		{
+			XOR_test_span_0,
+			XOR_test_span_1,
+			XOR_test_span_2,
+			XOR_test_span_3,
+			XOR_test_span_4,
+			XOR_test_span_5,
+			XOR_test_span_6,
+			XOR_test_span_7,
+		},
 	},
 	{
 		34, 8,	// #6 "black_test"
@@ -2676,6 +2507,16 @@ const sprite_rom sprite_def[10] PROGMEM =
 			black_test_bmap_6,
 			black_test_bmap_7,
 		},
+		{
+			black_test_span_0,
+			black_test_span_1,
+			black_test_span_2,
+			black_test_span_3,
+			black_test_span_4,
+			black_test_span_5,
+			black_test_span_6,
+			black_test_span_7,
+		},
 	},
 	{
 		16, 16,	// #7 "ball_1"
@@ -2689,18 +2530,38 @@ const sprite_rom sprite_def[10] PROGMEM =
 			ball_1_bmap_6,
 			ball_1_bmap_7,
 		},
+		{
+			ball_1_span_0,
+			ball_1_span_1,
+			ball_1_span_2,
+			ball_1_span_3,
+			ball_1_span_4,
+			ball_1_span_5,
+			ball_1_span_6,
+			ball_1_span_7,
+		},
 	},
 	{
 		48, 46,	// #8 "death_star"
 		{
 			death_star_bmap_0,
-			death_star_bmap_1,
-			death_star_bmap_2,
-			death_star_bmap_3,
-			death_star_bmap_4,
-			death_star_bmap_5,
-			death_star_bmap_6,
-			death_star_bmap_7,
+			0,	// runtime shifted
+			0,	// runtime shifted
+			0,	// runtime shifted
+			0,	// runtime shifted
+			0,	// runtime shifted
+			0,	// runtime shifted
+			0,	// runtime shifted
+		},
+		{
+			death_star_span_0,
+			death_star_span_1,
+			death_star_span_2,
+			death_star_span_3,
+			death_star_span_4,
+			death_star_span_5,
+			death_star_span_6,
+			death_star_span_7,
 		},
 	},
 };
@@ -2717,4 +2578,43 @@ enum
 	SPRITE_death_star = 9,
 	SPRITE_NUM_IMAGES = 9
 };
+const uint8_t all_images_anim[] PROGMEM =
+{
+	SPRITE_square, 60,
+	SPRITE_smiley_test, 60,
+	SPRITE_pixel, 60,
+	SPRITE_pixel2, 60,
+	SPRITE_pixel7, 60,
+	SPRITE_XOR_test, 60,
+	SPRITE_black_test, 60,
+	SPRITE_ball_1, 60,
+	SPRITE_death_star, 60,
+};
+
+const sprite_anim sprite_anims[2] PROGMEM =
+{
+	{ all_images_anim, 9, SPRITE_ANIM_LOOP },
+};
+enum
+{
+	ANIM_all_images = 1,
+	SPRITE_NUM_ANIMS = 1
+};
+const sprite_part boot_group_meta[] PROGMEM =
+{
+	{ SPRITE_death_star, 0, 0 },
+	{ SPRITE_square, 24, 24 },
+	{ SPRITE_XOR_test, 56, 56 },
+};
+
+const sprite_meta sprite_metas[2] PROGMEM =
+{
+	{ boot_group_meta, 3, 86, 64 },
+};
+enum
+{
+	SPRITE_boot_group = SPRITE_NUM_IMAGES + 1,
+	SPRITE_NUM_METAS = 1
+};
+// Sprite image flash: 3574 bytes (8082 if all pre-shifted)
 // EOF
@@ -0,0 +1,60 @@
+// Song "title_music" from "title_music.txt" (crunch_music)
+
+const uint8_t title_music_pattern0[43] PROGMEM =	// 16 rows
+{
+	0x80, 0x3d, 0x81, 0x19, 0x82, 0xa1, 0x47, 0x31, 0xc2, 0x41, 0xc2, 0x25, 0xc0, 0x44, 0xc2, 0x19,
+	0xc0, 0x41, 0xc2, 0x25, 0xc0, 0x42, 0x12, 0xa1, 0x39, 0x2a, 0xc2, 0x46, 0xc2, 0x1e, 0xc0, 0x49,
+	0xc2, 0x12, 0xc0, 0xa2, 0x20, 0x46, 0xc1, 0x60, 0x1e, 0xc0, 0xff,
+};
+
+const uint8_t title_music_pattern1[39] PROGMEM =	// 16 rows
+{
+	0x44, 0x14, 0xa1, 0x47, 0x2c, 0xc2, 0x3f, 0xc2, 0x20, 0xc0, 0x3c, 0xc2, 0x14, 0xc0, 0x3f, 0xc2,
+	0x20, 0xc0, 0x3d, 0x19, 0xa1, 0x37, 0x31, 0xc2, 0x40, 0xc2, 0x25, 0xc0, 0xa2, 0xff, 0x38, 0xc2,
+	0x19, 0xc0, 0x60, 0x60, 0x60, 0xc2, 0xff,
+};
+
+const uint8_t * const title_music_patterns[2] PROGMEM =
+{
+	title_music_pattern0,
+	title_music_pattern1,
+};
+
+const uint8_t title_music_orders[5] PROGMEM =
+{
+	0, 1, 0, 1, AUDIO_SEQ_LOOP
+};
+
+#if AUDIO_ENVELOPE
+const audio_envelope title_music_lead_env PROGMEM =	// attack, decay, sustain, release, slide, vibrato rate, depth
+{
+	64, 8, 160, 12, 0, 12, 6
+};
+
+const audio_envelope title_music_pluck_env PROGMEM =	// attack, decay, sustain, release, slide, vibrato rate, depth
+{
+	0, 16, 0, 0, 0, 0, 0
+};
+
+#endif
+
+const audio_instrument title_music_instruments[3] PROGMEM =
+{
+#if AUDIO_ENVELOPE
+	{ SinTable, 85, &title_music_lead_env },
+	{ TriTable, 85, &title_music_pluck_env },
+	{ SinTable, 40, 0 },
+#else
+	{ SinTable, 85 },
+	{ TriTable, 85 },
+	{ SinTable, 40 },
+#endif
+};
+
+const audio_song title_music_song PROGMEM =
+{
+	title_music_patterns, title_music_orders, title_music_instruments, 3, 7
+};
+
+// Song flash: 128 bytes
+// EOF
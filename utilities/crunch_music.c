@@ -0,0 +1,444 @@
+// Hacktastic Q & D text tracker -> TVGameKit music cruncher (see audio_music_frame in AVRInvaders_audio.h)
+//
+// Input is a text file, one command per line ('#' after a space starts a comment):
+//
+//	voices <n>			slots per pattern row (default 3)
+//	speed <frames>			frames per row (default 6)
+//	envelope <name> <attack> <decay> <sustain> <release> [<slide> [<vibrato rate> <vibrato depth>]]
+//					volume/pitch envelope (used with AUDIO_ENVELOPE, see audio_envelope in AVRInvaders_audio.h)
+//	instrument <wave> <volume> [<envelope>]
+//					next instrument (0-31), <wave> is a 256 byte aligned PROGMEM table (e.g., SinTable)
+//	pattern				start next pattern (0-254), followed by one row per line with <voices> slots:
+//	<slot> ...			C-4 (or C#4, note C-0 to A#7), --- (empty) or === (note off), then optional
+//					/<instrument> and ,<effect><hex param> with effect A (arpeggio), S (slide),
+//					V (volume) or F (frames per row), e.g., "C-4/1,A37" or "---,S-8"
+//	order <pattern> ...		order list (patterns to play), optionally ending with "loop"
+
+#if !defined(ARDUINO)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+#if defined(_MSC_VER)
+#define strdup	_strdup
+#endif
+
+#define MAX_PATTERNS	255
+#define MAX_INSTRUMENTS	32
+#define MAX_ORDERS	256
+#define MAX_PATTERN	8192		// bytes per pattern
+#define MAX_ENVELOPES	32
+
+// must match AVRInvaders_audio.h
+enum
+{
+	SEQ_NOTE_OFF	= 0x60,
+	SEQ_INSTRUMENT	= 0x80,
+	SEQ_EFFECT	= 0xa0,
+	SEQ_SKIP	= 0xc0,
+	SEQ_END		= 0xff,
+	SEQ_LOOP	= 0xfe
+};
+
+enum
+{
+	FX_NONE		= 0,
+	FX_ARPEGGIO	= 1,
+	FX_SLIDE	= 2,
+	FX_VOLUME	= 3,
+	FX_SPEED	= 4
+};
+
+struct pattern_info
+{
+	uint8_t *data;
+	int32_t size;
+	int32_t rows;
+	int32_t skip;			// empty slots not yet written
+};
+
+int32_t	verbose;
+int32_t	voices = 3;
+int32_t	speed = 6;
+int32_t	num_patterns;
+struct pattern_info pattern[MAX_PATTERNS];
+int32_t	num_instruments;
+char *instrument_wave[MAX_INSTRUMENTS];
+int32_t	instrument_vol[MAX_INSTRUMENTS];
+char *instrument_env[MAX_INSTRUMENTS];
+int32_t	num_envelopes;
+char *envelope_name[MAX_ENVELOPES];
+int32_t	envelope[MAX_ENVELOPES][7];
+int32_t	num_orders;
+int32_t	orders[MAX_ORDERS];
+int32_t	order_loop;
+
+const char *file_name;
+int32_t	line_num;
+
+static void error(const char *msg, const char *token)
+{
+	fprintf(stderr, "%s:%d: %s \"%s\".\n", file_name, line_num, msg, token);
+	exit(5);
+}
+
+static void put_byte(struct pattern_info *p, int32_t b)
+{
+	if (p->size >= MAX_PATTERN)
+		error("Pattern too large", "");
+	p->data[p->size++] = (uint8_t)b;
+}
+
+// write pending empty slots as skip bytes
+static void flush_skip(struct pattern_info *p)
+{
+	while (p->skip)
+	{
+		int32_t n = p->skip > 63 ? 63 : p->skip;
+		put_byte(p, SEQ_SKIP + n - 1);
+		p->skip -= n;
+	}
+}
+
+// parse one row slot into pattern
+static void put_slot(struct pattern_info *p, char *slot)
+{
+	static const int8_t semitones[7] = { 9, 11, 0, 2, 4, 5, 7 };	// A-G
+	int32_t note = 0, ins = -1, fx = FX_NONE, param = 0;
+	char *s = slot;
+
+	if (strncmp(s, "---", 3) == 0)
+		note = 0;
+	else if (strncmp(s, "===", 3) == 0)
+		note = SEQ_NOTE_OFF;
+	else
+	{
+		char c = toupper(s[0]);
+		if (c < 'A' || c > 'G' || (s[1] != '-' && s[1] != '#') || s[2] < '0' || s[2] > '7')
+			error("Bad note", slot);
+		note = (s[2] - '0') * 12 + semitones[c - 'A'] + (s[1] == '#') + 1;
+		if (note < 1 || note >= SEQ_NOTE_OFF)
+			error("Note out of range", slot);
+	}
+	s += 3;
+	if (*s == '/')
+	{
+		ins = strtol(s+1, &s, 10);
+		if (ins < 0 || ins >= num_instruments)
+			error("Bad instrument", slot);
+	}
+	if (*s == ',')
+	{
+		switch (toupper(s[1]))
+		{
+			case 'A': fx = FX_ARPEGGIO; break;
+			case 'S': fx = FX_SLIDE; break;
+			case 'V': fx = FX_VOLUME; break;
+			case 'F': fx = FX_SPEED; break;
+			default: error("Bad effect", slot);
+		}
+		param = strtol(s+2, &s, 16);
+		if (param < -128 || param > 255)
+			error("Bad effect parameter", slot);
+		param &= 0xff;
+	}
+	if (*s)
+		error("Junk after slot", slot);
+
+	if (note == 0 && ins < 0 && fx == FX_NONE)
+	{
+		p->skip++;
+		return;
+	}
+	flush_skip(p);
+	if (ins >= 0)
+		put_byte(p, SEQ_INSTRUMENT + ins);
+	if (fx != FX_NONE)
+	{
+		put_byte(p, SEQ_EFFECT + fx);
+		put_byte(p, param);
+	}
+	put_byte(p, note);
+}
+
+static void end_pattern(void)
+{
+	if (num_patterns)
+	{
+		struct pattern_info *p = &pattern[num_patterns-1];
+		flush_skip(p);
+		put_byte(p, SEQ_END);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int32_t arg, i, j, total;
+	char *name = NULL;
+	char line[1024];
+	FILE* f = NULL;
+
+	for (arg = 1; arg < argc; arg++)
+	{
+		if (argv[arg][0] == '-')
+		{
+			char *namestr = NULL;
+			char c = argv[arg][1];
+			if (c >= 'A' && c <= 'Z')
+			c += 32;
+			switch(c)
+			{
+			case 'v':
+				verbose = (verbose + 1) & 0x3;
+				break;
+
+			case 'n':
+				namestr = &argv[arg][2];
+
+				if (*namestr == 0 && arg+1 < argc)
+				namestr = argv[++arg];
+
+				if (*namestr == 0)
+				{
+					fprintf(stderr, "Need symbol name after -n.\n");
+					exit(5);
+				}
+				name = strdup(namestr);
+
+				break;
+
+			default:
+				printf("Usage: crunch_music [options ...] <input text song> [-n <song name>]\n");
+				printf("\n");
+				printf(" -n <name>	- Name of song (or file name used)\n");
+				printf(" -v	 - Verbose (print pattern rows as comments)\n");
+				printf("\n");
+				printf("Output will go to stdout, so use \"> output\" to redirect to file.\n");
+				exit(1);
+
+				break;
+			}
+
+			continue;
+		}
+		file_name = argv[arg];
+	}
+
+	if (!file_name)
+	{
+		fprintf(stderr, "Need input text song (-h for help).\n");
+		exit(5);
+	}
+	if ((f = fopen(file_name, "r")) == NULL)
+	{
+		fprintf(stderr, "Error opening input text song \"%s\".\n", file_name);
+		exit(5);
+	}
+	if (!name)
+	{
+		char *e;
+		const char *b = strrchr(file_name, '/');
+		name = strdup(b ? b+1 : file_name);
+		if ((e = strchr(name, '.')) != NULL)
+			*e = 0;
+	}
+
+	printf("// Song \"%s\" from \"%s\" (crunch_music)\n\n", name, file_name);
+
+	while (fgets(line, sizeof (line), f))
+	{
+		char *tok[64];
+		int32_t n = 0;
+		char *c;
+
+		line_num++;
+		for (c = line; *c; c++)
+		{
+			if (*c == '#' && (c == line || isspace((unsigned char)c[-1])))	// comment (but not C#4)
+			{
+				*c = 0;
+				break;
+			}
+		}
+		for (c = strtok(line, " \t\r\n"); c && n < 64; c = strtok(NULL, " \t\r\n"))
+			tok[n++] = c;
+		if (n == 0)
+			continue;
+
+		if (strcmp(tok[0], "voices") == 0 && n == 2)
+		{
+			voices = atoi(tok[1]);
+			if (voices < 1 || voices > 8 || num_patterns)
+				error("Bad voices (1-8, before patterns)", tok[1]);
+		}
+		else if (strcmp(tok[0], "speed") == 0 && n == 2)
+		{
+			speed = atoi(tok[1]);
+			if (speed < 1 || speed > 255)
+				error("Bad speed", tok[1]);
+		}
+		else if (strcmp(tok[0], "envelope") == 0 && (n == 6 || n == 7 || n == 9))
+		{
+			if (num_envelopes >= MAX_ENVELOPES)
+				error("Too many envelopes", tok[1]);
+			envelope_name[num_envelopes] = strdup(tok[1]);
+			for (i = 0; i < 7; i++)
+				envelope[num_envelopes][i] = (i + 2 < n) ? atoi(tok[i + 2]) : 0;
+			if (envelope[num_envelopes][4] < -128 || envelope[num_envelopes][4] > 127)
+				error("Bad envelope slide", tok[6]);
+			num_envelopes++;
+		}
+		else if (strcmp(tok[0], "instrument") == 0 && (n == 3 || n == 4))
+		{
+			if (num_instruments >= MAX_INSTRUMENTS)
+				error("Too many instruments", tok[1]);
+			instrument_wave[num_instruments] = strdup(tok[1]);
+			instrument_vol[num_instruments] = atoi(tok[2]) & 0xff;
+			if (n == 4)
+			{
+				for (i = 0; i < num_envelopes; i++)
+					if (strcmp(envelope_name[i], tok[3]) == 0)
+						break;
+				if (i == num_envelopes)
+					error("Unknown envelope", tok[3]);
+				instrument_env[num_instruments] = envelope_name[i];
+			}
+			num_instruments++;
+		}
+		else if (strcmp(tok[0], "pattern") == 0 && n == 1)
+		{
+			end_pattern();
+			if (num_patterns >= MAX_PATTERNS)
+				error("Too many patterns", tok[0]);
+			pattern[num_patterns].data = malloc(MAX_PATTERN);
+			num_patterns++;
+		}
+		else if (strcmp(tok[0], "order") == 0)
+		{
+			for (i = 1; i < n; i++)
+			{
+				if (strcmp(tok[i], "loop") == 0)
+				{
+					order_loop = 1;
+					continue;
+				}
+				if (num_orders >= MAX_ORDERS-1)
+					error("Too many orders", tok[i]);
+				orders[num_orders++] = atoi(tok[i]);
+			}
+		}
+		else
+		{
+			struct pattern_info *p;
+			if (!num_patterns)
+				error("Row before pattern", tok[0]);
+			p = &pattern[num_patterns-1];
+			if (n != voices)
+				error("Wrong number of slots in row", tok[0]);
+			if (verbose)
+			{
+				printf("// %d:%3d:", num_patterns-1, p->rows);
+				for (i = 0; i < n; i++)
+					printf(" %-10s", tok[i]);
+				printf("\n");
+			}
+			for (i = 0; i < n; i++)
+				put_slot(p, tok[i]);
+			p->rows++;
+		}
+	}
+	fclose(f);
+	end_pattern();
+
+	if (num_orders == 0 || num_instruments == 0)
+	{
+		fprintf(stderr, "Error song \"%s\" needs an instrument, pattern and order.\n", file_name);
+		exit(5);
+	}
+	for (i = 0; i < num_orders; i++)
+	{
+		if (orders[i] < 0 || orders[i] >= num_patterns)
+		{
+			fprintf(stderr, "Error song \"%s\" order %d has bad pattern %d.\n", file_name, i, orders[i]);
+			exit(5);
+		}
+	}
+	if (verbose)
+		printf("\n");
+
+	total = 0;
+	for (i = 0; i < num_patterns; i++)
+	{
+		struct pattern_info *p = &pattern[i];
+		printf("const uint8_t %s_pattern%d[%d] PROGMEM =\t// %d rows\n", name, i, p->size, p->rows);
+		printf("{");
+		for (j = 0; j < p->size; j++)
+			printf("%s0x%02x,", (j & 15) ? " " : "\n\t", p->data[j]);
+		printf("\n};\n\n");
+		total += p->size;
+	}
+
+	printf("const uint8_t * const %s_patterns[%d] PROGMEM =\n", name, num_patterns);
+	printf("{\n");
+	for (i = 0; i < num_patterns; i++)
+		printf("\t%s_pattern%d,\n", name, i);
+	printf("};\n\n");
+
+	printf("const uint8_t %s_orders[%d] PROGMEM =\n", name, num_orders+1);
+	printf("{\n\t");
+	for (i = 0; i < num_orders; i++)
+		printf("%d, ", orders[i]);
+	printf("%s\n", order_loop ? "AUDIO_SEQ_LOOP" : "AUDIO_SEQ_END");
+	printf("};\n\n");
+
+	if (num_envelopes)
+	{
+		printf("#if AUDIO_ENVELOPE\n");
+		for (i = 0; i < num_envelopes; i++)
+		{
+			printf("const audio_envelope %s_%s_env PROGMEM =\t// attack, decay, sustain, release, slide, vibrato rate, depth\n", name, envelope_name[i]);
+			printf("{\n\t");
+			for (j = 0; j < 7; j++)
+				printf("%d%s", envelope[i][j], j < 6 ? ", " : "\n");
+			printf("};\n\n");
+		}
+		printf("#endif\n\n");
+	}
+
+	printf("const audio_instrument %s_instruments[%d] PROGMEM =\n", name, num_instruments);
+	printf("{\n");
+	if (num_envelopes)
+	{
+		printf("#if AUDIO_ENVELOPE\n");
+		for (i = 0; i < num_instruments; i++)
+		{
+			if (instrument_env[i])
+				printf("\t{ %s, %d, &%s_%s_env },\n", instrument_wave[i], instrument_vol[i], name, instrument_env[i]);
+			else
+				printf("\t{ %s, %d, 0 },\n", instrument_wave[i], instrument_vol[i]);
+		}
+		printf("#else\n");
+	}
+	for (i = 0; i < num_instruments; i++)
+		printf("\t{ %s, %d },\n", instrument_wave[i], instrument_vol[i]);
+	if (num_envelopes)
+		printf("#endif\n");
+	printf("};\n\n");
+
+	printf("const audio_song %s_song PROGMEM =\n", name);
+	printf("{\n");
+	printf("\t%s_patterns, %s_orders, %s_instruments, %d, %d\n", name, name, name, voices, speed);
+	printf("};\n\n");
+
+	total += num_patterns * 2 + num_orders + 1 + num_instruments * (num_envelopes ? 5 : 3) + num_envelopes * 7 + 8;
+	printf("// Song flash: %d bytes\n", total);
+	printf("// EOF\n");
+	fprintf(stderr, "Done!\n");
+
+	return 0;
+}
+
+#endif
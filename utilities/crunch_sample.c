@@ -0,0 +1,320 @@
+// Hacktastic Q & D WAV -> TVGameKit sample cruncher (see audio_sample_play in AVRInvaders_audio.h)
+//
+// Reads an uncompressed PCM WAV (8 or 16-bit, mono or stereo, any rate), mixes it to mono, resamples it to the
+// audio sample rate (one sample per scanline) and writes PROGMEM 4-bit IMA ADPCM (or 8-bit PCM) data.
+
+#if !defined(ARDUINO)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#define strdup	_strdup
+#endif
+
+// must match AVRInvaders_audio.h
+enum
+{
+	SAMPLE_PCM8,
+	SAMPLE_ADPCM4
+};
+
+static const int32_t adpcm_steps[89] =
+{
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97,
+	107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+	876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871,
+	5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623,
+	27086, 29794, 32767
+};
+
+static const int32_t adpcm_index[8] =
+{
+	-1, -1, -1, -1, 2, 4, 6, 8
+};
+
+int32_t	verbose;
+int32_t	format = SAMPLE_ADPCM4;
+double	out_rate = 1000000.0 / 63.5558;		// NTSC scanline rate (AUDIO_RATE)
+double	gain = 1.0;
+
+int32_t	wav_channels;
+int32_t	wav_rate;
+int32_t	wav_bits;
+int32_t	wav_samples;
+int16_t	*wav_data;				// mono 16-bit
+
+static uint32_t get_le(const uint8_t *p, int32_t n)
+{
+	uint32_t v = 0;
+	while (n--)
+		v = (v << 8) | p[n];
+	return v;
+}
+
+static void read_wav(const char *wav_name)
+{
+	uint8_t hdr[12], chunk[8], fmt[16];
+	FILE *f;
+	int32_t i, c;
+
+	if ((f = fopen(wav_name, "rb")) == NULL)
+	{
+		fprintf(stderr, "Error opening input WAV file \"%s\".\n", wav_name);
+		exit(5);
+	}
+	if (fread(hdr, 1, 12, f) != 12 || memcmp(hdr, "RIFF", 4) != 0 || memcmp(hdr+8, "WAVE", 4) != 0)
+	{
+		fprintf(stderr, "Error not valid WAV format \"%s\".\n", wav_name);
+		exit(5);
+	}
+	while (fread(chunk, 1, 8, f) == 8)
+	{
+		uint32_t size = get_le(chunk+4, 4);
+		if (memcmp(chunk, "fmt ", 4) == 0)
+		{
+			if (size < 16 || fread(fmt, 1, 16, f) != 16)
+			{
+				fprintf(stderr, "Error reading WAV format from \"%s\".\n", wav_name);
+				exit(5);
+			}
+			wav_channels = get_le(fmt+2, 2);
+			wav_rate = get_le(fmt+4, 4);
+			wav_bits = get_le(fmt+14, 2);
+			if (get_le(fmt, 2) != 1 || (wav_bits != 8 && wav_bits != 16) || wav_channels < 1)
+			{
+				fprintf(stderr, "Error unsupported WAV format (need 8 or 16-bit PCM) \"%s\".\n", wav_name);
+				exit(5);
+			}
+			fseek(f, size - 16 + (size & 1), SEEK_CUR);
+		}
+		else if (memcmp(chunk, "data", 4) == 0)
+		{
+			int32_t bytes = wav_bits / 8;
+			uint8_t *raw = malloc(size);
+			if (!wav_channels || fread(raw, 1, size, f) != size)
+			{
+				fprintf(stderr, "Error reading WAV data from \"%s\".\n", wav_name);
+				exit(5);
+			}
+			wav_samples = size / (bytes * wav_channels);
+			wav_data = malloc(wav_samples * sizeof (int16_t) + 1);
+			for (i = 0; i < wav_samples; i++)
+			{
+				int32_t sum = 0;
+				for (c = 0; c < wav_channels; c++)
+				{
+					const uint8_t *p = raw + (i * wav_channels + c) * bytes;
+					sum += bytes == 1 ? (p[0] - 128) << 8 : (int16_t)get_le(p, 2);
+				}
+				wav_data[i] = (int16_t)(sum / wav_channels);
+			}
+			free(raw);
+			break;
+		}
+		else
+			fseek(f, size + (size & 1), SEEK_CUR);
+	}
+	fclose(f);
+	if (!wav_samples)
+	{
+		fprintf(stderr, "Error no WAV data in \"%s\".\n", wav_name);
+		exit(5);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int32_t arg, i, length, bytes;
+	char *name = NULL;
+	const char *wav_name = NULL;
+	int16_t *pcm;
+	uint8_t *out;
+
+	for (arg = 1; arg < argc; arg++)
+	{
+		if (argv[arg][0] == '-')
+		{
+			char *namestr = NULL;
+			char c = argv[arg][1];
+			if (c >= 'A' && c <= 'Z')
+			c += 32;
+			switch(c)
+			{
+			case 'v':
+				verbose = (verbose + 1) & 0x3;
+				break;
+
+			case 'p':
+				format = SAMPLE_PCM8;
+				break;
+
+			case 'a':
+				format = SAMPLE_ADPCM4;
+				break;
+
+			case 'r':
+			case 'g':
+				namestr = &argv[arg][2];
+
+				if (*namestr == 0 && arg+1 < argc)
+				namestr = argv[++arg];
+
+				if (c == 'r')
+					out_rate = atof(namestr);
+				else
+					gain = atof(namestr);
+				if (out_rate < 1000.0 || gain <= 0.0)
+				{
+					fprintf(stderr, "Need rate (1000 or more) after -r or gain after -g.\n");
+					exit(5);
+				}
+
+				break;
+
+			case 'n':
+				namestr = &argv[arg][2];
+
+				if (*namestr == 0 && arg+1 < argc)
+				namestr = argv[++arg];
+
+				if (*namestr == 0)
+				{
+					fprintf(stderr, "Need symbol name after -n.\n");
+					exit(5);
+				}
+				name = strdup(namestr);
+
+				break;
+
+			default:
+				printf("Usage: crunch_sample [options ...] <input WAV> [-n <sample name>]\n");
+				printf("\n");
+				printf(" -a	 - 4-bit IMA ADPCM output (default)\n");
+				printf(" -p	 - 8-bit PCM output\n");
+				printf(" -g <gain>	- Volume scale (default 1.0)\n");
+				printf(" -r <rate>	- Output sample rate (default NTSC scanline rate %.1f, PAL is 15625)\n", out_rate);
+				printf(" -n <name>	- Name of sample (or file name used)\n");
+				printf(" -v	 - Verbose\n");
+				printf("\n");
+				printf("Output will go to stdout, so use \"> output\" to redirect to file.\n");
+				exit(1);
+
+				break;
+			}
+
+			continue;
+		}
+		wav_name = argv[arg];
+	}
+
+	if (!wav_name)
+	{
+		fprintf(stderr, "Need input WAV (-h for help).\n");
+		exit(5);
+	}
+	read_wav(wav_name);
+	if (!name)
+	{
+		char *e;
+		const char *b = strrchr(wav_name, '/');
+		name = strdup(b ? b+1 : wav_name);
+		if ((e = strchr(name, '.')) != NULL)
+			*e = 0;
+	}
+
+	// resample (linear interpolation) with gain
+	length = (int32_t)((double)wav_samples * out_rate / wav_rate);
+	if (length > 65535)
+	{
+		fprintf(stderr, "Error sample too long (%d samples, 65535 maximum).\n", length);
+		exit(5);
+	}
+	pcm = malloc(length * sizeof (int16_t) + 2);
+	for (i = 0; i < length; i++)
+	{
+		double pos = (double)i * wav_rate / out_rate;
+		int32_t p = (int32_t)pos;
+		double frac = pos - p;
+		double v = wav_data[p] * (1.0 - frac) + (p+1 < wav_samples ? wav_data[p+1] : 0) * frac;
+		v *= gain;
+		pcm[i] = v > 32767.0 ? 32767 : v < -32768.0 ? -32768 : (int16_t)v;
+	}
+
+	out = malloc(length + 1);
+	if (format == SAMPLE_PCM8)
+	{
+		for (i = 0; i < length; i++)
+			out[i] = (uint8_t)(pcm[i] >> 8);
+		bytes = length;
+	}
+	else
+	{
+		int32_t pred = 0, index = 0;
+		memset(out, 0, length + 1);
+		for (i = 0; i < length; i++)
+		{
+			int32_t step = adpcm_steps[index];
+			int32_t diff = pcm[i] - pred;
+			int32_t code = 0, d;
+			if (diff < 0)
+			{
+				code = 8;
+				diff = -diff;
+			}
+			if (diff >= step)
+			{
+				code |= 4;
+				diff -= step;
+			}
+			if (diff >= step >> 1)
+			{
+				code |= 2;
+				diff -= step >> 1;
+			}
+			if (diff >= step >> 2)
+				code |= 1;
+
+			// update predictor exactly as decoder does
+			d = step >> 3;
+			if (code & 4)
+				d += step;
+			if (code & 2)
+				d += step >> 1;
+			if (code & 1)
+				d += step >> 2;
+			pred += (code & 8) ? -d : d;
+			pred = pred > 32767 ? 32767 : pred < -32768 ? -32768 : pred;
+			index += adpcm_index[code & 7];
+			index = index < 0 ? 0 : index > 88 ? 88 : index;
+
+			out[i >> 1] |= (i & 1) ? code << 4 : code;
+		}
+		bytes = (length + 1) / 2;
+	}
+
+	printf("// Sample \"%s\" from \"%s\" (crunch_sample): %d samples at %.1f Hz, %s (%d bytes)\n\n", name, wav_name,
+		length, out_rate, format == SAMPLE_PCM8 ? "8-bit PCM" : "4-bit IMA ADPCM", bytes);
+	if (verbose)
+		printf("// WAV: %d Hz, %d-bit, %d channel(s), %d samples\n\n", wav_rate, wav_bits, wav_channels, wav_samples);
+
+	printf("const uint8_t %s_data[%d] PROGMEM =\n", name, bytes);
+	printf("{");
+	for (i = 0; i < bytes; i++)
+		printf("%s0x%02x,", (i & 15) ? " " : "\n\t", out[i]);
+	printf("\n};\n\n");
+
+	printf("const audio_sample %s_sample PROGMEM =\n", name);
+	printf("{\n");
+	printf("\t%s_data, %d, %s\n", name, length, format == SAMPLE_PCM8 ? "AUDIO_SAMPLE_PCM8" : "AUDIO_SAMPLE_ADPCM4");
+	printf("};\n\n");
+
+	printf("// EOF\n");
+	fprintf(stderr, "Done!\n");
+
+	return 0;
+}
+
+#endif
@@ -31,6 +31,7 @@ struct sprite_info
 	int32_t byte_width;
 	uint8_t *mono_bitmap;
 	uint8_t *mask_bitmap;
+	uint8_t runtime_shift;
 };
 
 int32_t	num_sprites;
@@ -47,9 +48,331 @@ struct sprite_info sprite[MAX_SPRITES];
 
 uint8_t human_readable = 0;
 uint8_t verbose = 0;
+uint8_t runtime_shift = 0;
 
 uint8_t preamble_done = 0;
 
+int32_t flash_bytes;
+int32_t preshift_bytes;
+
+#define MAX_ANIMS	64
+
+int32_t num_anims;
+char *anim_spec[MAX_ANIMS];		// "name=sprite[:frames],...[@loop|once|pingpong]" from -a
+
+#define MAX_METAS	64
+
+int32_t num_metas;
+char *meta_spec[MAX_METAS];		// "name=sprite:dx:dy,..." from -m
+
+// print sprite mask and data bitmap for one shift (column by column, mask and data byte for each row)
+void print_bitmap(struct sprite_info *spr, int32_t s)
+{
+	int32_t x, y;
+
+	printf("const uint8_t %s_bmap_%d[%d*%d*2] PROGMEM =\n", spr->name, s, (spr->width+s+7)/8, spr->height);
+	printf("{\n");
+
+	printf("// Bitmap shift %d (%d+%d x %d):\n", s, spr->width, s, spr->height);
+	if (verbose > 0)
+	{
+		printf("// Mask bitmap (%d x %d):\n", spr->width, spr->height);
+		for (y = 0; y < spr->height; y++)
+		{
+			printf("// ");
+			for (x = 0; x < spr->width+s; x += 8)
+			{
+				uint8_t b = spr->mask_bitmap[(y * spr->byte_width) + (x/8)];
+				printf("%s%s%s%s%s%s%s%s", b & 0x80 ? "#" : ".",
+							   b & 0x40 ? "#" : ".",
+							   b & 0x20 ? "#" : ".",
+							   b & 0x10 ? "#" : ".",
+							   b & 0x08 ? "#" : ".",
+							   b & 0x04 ? "#" : ".",
+							   b & 0x02 ? "#" : ".",
+							   b & 0x01 ? "#" : ".");
+			}
+			printf("\n");
+		}
+		printf("// Monochrome bitmap (%d+%d x %d):\n", spr->width, s, spr->height);
+		for (y = 0; y < spr->height; y++)
+		{
+			printf("// ");
+			for (x = 0; x < spr->width+s; x += 8)
+			{
+				uint8_t b = spr->mono_bitmap[(y * spr->byte_width) + (x/8)];
+				printf("%s%s%s%s%s%s%s%s", b & 0x80 ? "#" : ".",
+							   b & 0x40 ? "#" : ".",
+							   b & 0x20 ? "#" : ".",
+							   b & 0x10 ? "#" : ".",
+							   b & 0x08 ? "#" : ".",
+							   b & 0x04 ? "#" : ".",
+							   b & 0x02 ? "#" : ".",
+							   b & 0x01 ? "#" : ".");
+			}
+			printf("\n");
+		}
+	}
+	for (x = 0; x < spr->width+s; x += 8)
+	{
+		printf("\t");
+		for (y = 0; y < spr->height; y++)
+		{
+			uint8_t b = spr->mono_bitmap[(y * spr->byte_width) + (x/8)];
+			uint8_t m = spr->mask_bitmap[(y * spr->byte_width) + (x/8)];
+			if (human_readable)
+			{
+				printf("_( %s%s%s%s%s%s%s%s ),", m & 0x80 ? "W" : "_",
+								 m & 0x40 ? "W" : "_",
+								 m & 0x20 ? "W" : "_",
+								 m & 0x10 ? "W" : "_",
+								 m & 0x08 ? "W" : "_",
+								 m & 0x04 ? "W" : "_",
+								 m & 0x02 ? "W" : "_",
+								 m & 0x01 ? "W" : "_");
+				printf("_( %s%s%s%s%s%s%s%s ),", b & 0x80 ? "W" : "_",
+								 b & 0x40 ? "W" : "_",
+								 b & 0x20 ? "W" : "_",
+								 b & 0x10 ? "W" : "_",
+								 b & 0x08 ? "W" : "_",
+								 b & 0x04 ? "W" : "_",
+								 b & 0x02 ? "W" : "_",
+								 b & 0x01 ? "W" : "_");
+			}
+			else
+			{
+				printf("0x%02x,", m);
+				printf("0x%02x,", b);
+			}
+		}
+		printf("\n");
+	}
+
+	printf("};\n\n");
+}
+
+// print opaque and visible row runs for each column of one shift
+// (longest run of rows with mask 0x00, then first to last row with any non-transparent pixel, 0,0 if none)
+void print_spans(struct sprite_info *spr, int32_t s)
+{
+	int32_t x, y;
+
+	printf("const uint8_t %s_span_%d[%d*4] PROGMEM =\n", spr->name, s, (spr->width+s+7)/8);
+	printf("{\n");
+	for (x = 0; x < spr->width+s; x += 8)
+	{
+		int32_t o0 = 0, o1 = 0, start = 0;
+		int32_t v0 = 0, v1 = 0;
+
+		for (y = 0; y <= spr->height; y++)
+		{
+			if (y < spr->height)
+			{
+				uint8_t b = spr->mono_bitmap[(y * spr->byte_width) + (x/8)];
+				uint8_t m = spr->mask_bitmap[(y * spr->byte_width) + (x/8)];
+				if (m != 0xff || b != 0x00)
+				{
+					if (v1 == 0)
+						v0 = y;
+					v1 = y+1;
+				}
+				if (m == 0x00)
+					continue;
+			}
+			if (y - start > o1 - o0)
+			{
+				o0 = start;
+				o1 = y;
+			}
+			start = y+1;
+		}
+		printf("\t%d,%d, %d,%d,\n", o0, o1, v0, v1);
+	}
+	printf("};\n\n");
+}
+
+// find sprite by name, returns sprite number (1 based) or 0 if not found
+int32_t find_sprite(const char *name, int32_t len)
+{
+	int32_t i;
+
+	for (i = 0; i < num_sprites; i++)
+	{
+		if ((int32_t)strlen(sprite[i].name) == len && strncmp(sprite[i].name, name, len) == 0)
+			return i+1;
+	}
+
+	return 0;
+}
+
+// print animation frame table (SPRITE_ def and frames to show for each frame) and sprite_anims
+void print_anims()
+{
+	static const char *modes[3] = { "loop", "once", "pingpong" };
+	static const char *mode_enums[3] = { "SPRITE_ANIM_LOOP", "SPRITE_ANIM_ONCE", "SPRITE_ANIM_PINGPONG" };
+	int32_t counts[MAX_ANIMS];
+	int32_t mode[MAX_ANIMS];
+	int32_t i, j;
+
+	for (i = 0; i < num_anims; i++)
+	{
+		char *spec = anim_spec[i];
+		char *list = strchr(spec, '=');
+		char *m = strchr(spec, '@');
+
+		if (list == NULL || list == spec)
+		{
+			fprintf(stderr, "Bad animation \"%s\" (need name=sprite[:frames],...).\n", spec);
+			exit(5);
+		}
+		*list++ = 0;
+
+		mode[i] = 0;
+		if (m)
+		{
+			*m++ = 0;
+			for (j = 0; j < 3; j++)
+			{
+				if (strcmp(m, modes[j]) == 0)
+					break;
+			}
+			if (j == 3)
+			{
+				fprintf(stderr, "Bad animation mode \"%s\" for \"%s\" (loop, once or pingpong).\n", m, spec);
+				exit(5);
+			}
+			mode[i] = j;
+		}
+
+		printf("const uint8_t %s_anim[] PROGMEM =\n", spec);
+		printf("{\n");
+		counts[i] = 0;
+		while (*list)
+		{
+			int32_t len = strcspn(list, ":,");
+			int32_t def = find_sprite(list, len);
+			int32_t frames = 8;
+
+			if (def == 0)
+			{
+				fprintf(stderr, "Animation \"%s\" uses unknown sprite \"%.*s\".\n", spec, len, list);
+				exit(5);
+			}
+			printf("\tSPRITE_%.*s, ", len, list);
+			list += len;
+			if (*list == ':')
+				frames = strtol(list+1, &list, 10);
+			if (frames < 1 || frames > 255)
+			{
+				fprintf(stderr, "Animation \"%s\" frame time %d out of range (1-255).\n", spec, frames);
+				exit(5);
+			}
+			printf("%d,\n", frames);
+			if (*list == ',')
+				list++;
+			counts[i]++;
+		}
+		printf("};\n\n");
+
+		if (counts[i] < 1 || counts[i] > 127)
+		{
+			fprintf(stderr, "Animation \"%s\" needs 1 to 127 frames.\n", spec);
+			exit(5);
+		}
+	}
+
+	printf("const sprite_anim sprite_anims[%d] PROGMEM =\n", num_anims+1);
+	printf("{\n");
+	for (i = 0; i < num_anims; i++)
+		printf("\t{ %s_anim, %d, %s },\n", anim_spec[i], counts[i], mode_enums[mode[i]]);
+	printf("};\n");
+
+	printf("enum\n");
+	printf("{\n");
+	for (i = 0; i < num_anims; i++)
+		printf("	ANIM_%s = %d,\n", anim_spec[i], i+1);
+	printf("	SPRITE_NUM_ANIMS = %d\n", num_anims);
+	printf("};\n");
+}
+
+// print meta-sprite part tables (SPRITE_ def and offset of each part) and sprite_metas
+void print_metas()
+{
+	int32_t counts[MAX_METAS];
+	int32_t w[MAX_METAS], h[MAX_METAS];
+	int32_t i;
+
+	for (i = 0; i < num_metas; i++)
+	{
+		char *spec = meta_spec[i];
+		char *list = strchr(spec, '=');
+
+		if (list == NULL || list == spec)
+		{
+			fprintf(stderr, "Bad meta-sprite \"%s\" (need name=sprite:dx:dy,...).\n", spec);
+			exit(5);
+		}
+		*list++ = 0;
+
+		printf("const sprite_part %s_meta[] PROGMEM =\n", spec);
+		printf("{\n");
+		counts[i] = 0;
+		w[i] = 0;
+		h[i] = 0;
+		while (*list)
+		{
+			int32_t len = strcspn(list, ":,");
+			int32_t def = find_sprite(list, len);
+			int32_t dx = 0, dy = 0;
+
+			if (def == 0)
+			{
+				fprintf(stderr, "Meta-sprite \"%s\" uses unknown sprite \"%.*s\".\n", spec, len, list);
+				exit(5);
+			}
+			printf("\t{ SPRITE_%.*s, ", len, list);
+			list += len;
+			if (*list == ':')
+				dx = strtol(list+1, &list, 10);
+			if (*list == ':')
+				dy = strtol(list+1, &list, 10);
+			if (dx < 0 || dy < 0 || dx + sprite[def-1].width > 255 || dy + sprite[def-1].height > 255)
+			{
+				fprintf(stderr, "Meta-sprite \"%s\" part offset %d, %d out of range.\n", spec, dx, dy);
+				exit(5);
+			}
+			printf("%d, %d },\n", dx, dy);
+			if (dx + sprite[def-1].width > w[i])
+				w[i] = dx + sprite[def-1].width;
+			if (dy + sprite[def-1].height > h[i])
+				h[i] = dy + sprite[def-1].height;
+			if (*list == ',')
+				list++;
+			counts[i]++;
+		}
+		printf("};\n\n");
+
+		if (counts[i] < 1 || counts[i] > 255)
+		{
+			fprintf(stderr, "Meta-sprite \"%s\" needs 1 to 255 parts.\n", spec);
+			exit(5);
+		}
+	}
+
+	printf("const sprite_meta sprite_metas[%d] PROGMEM =\n", num_metas+1);
+	printf("{\n");
+	for (i = 0; i < num_metas; i++)
+		printf("\t{ %s_meta, %d, %d, %d },\n", meta_spec[i], counts[i], w[i], h[i]);
+	printf("};\n");
+
+	printf("enum\n");
+	printf("{\n");
+	for (i = 0; i < num_metas; i++)
+		printf("	SPRITE_%s = SPRITE_NUM_IMAGES + %d,\n", meta_spec[i], i+1);
+	printf("	SPRITE_NUM_METAS = %d\n", num_metas);
+	printf("};\n");
+}
+
 int main(int argc, char* argv[])
 {
 	int32_t s, i, j, x, y, size;
@@ -79,6 +402,42 @@ int main(int argc, char* argv[])
 				human_readable ^= 1;
 				break;
 
+			case 'r':
+				runtime_shift ^= 1;
+				break;
+
+			case 'a':
+				namestr = &argv[arg][2];
+
+				if (*namestr == 0 && arg+1 < argc)
+				namestr = argv[++arg];
+
+				if (*namestr == 0 || num_anims >= MAX_ANIMS)
+				{
+					fprintf(stderr, "Need animation after -a (or too many).\n");
+					exit(5);
+				}
+
+				anim_spec[num_anims++] = strdup(namestr);
+
+				break;
+
+			case 'm':
+				namestr = &argv[arg][2];
+
+				if (*namestr == 0 && arg+1 < argc)
+				namestr = argv[++arg];
+
+				if (*namestr == 0 || num_metas >= MAX_METAS)
+				{
+					fprintf(stderr, "Need meta-sprite after -m (or too many).\n");
+					exit(5);
+				}
+
+				meta_spec[num_metas++] = strdup(namestr);
+
+				break;
+
 			case 'n':
 				namestr = &argv[arg][2];
 				
@@ -101,7 +460,10 @@ int main(int argc, char* argv[])
 			default:
 				printf("Usage: crunch_sprite [options ...] <input BMP ...> [-n <sprite name>]\n");
 				printf("\n");
+				printf(" -a <anim>	- Animation <name>=<sprite>[:<frames>],...[@loop|once|pingpong] (output after sprites)\n");
+				printf(" -m <meta>	- Meta-sprite <name>=<sprite>:<dx>:<dy>,... drawn as one sprite (output after sprites)\n");
 				printf(" -n <name>	- Name of next tilemap or tileset font (or BMP name used)\n");
+				printf(" -r	 - Toggle runtime shifting for following sprites (only unshifted image in flash)\n");
 				printf(" -v	 - Verbose (repeat up to three times to increase)\n");
 				printf("\n");
 				printf("Output will go to stdout, so use \"> output\" to redirect to file.\n");
@@ -254,6 +616,7 @@ int main(int argc, char* argv[])
 		}
 
 		spr->width = bmp_width;
+		spr->runtime_shift = runtime_shift;
 		spr->byte_width = ((spr->width + 7)/8)+1;
 		spr->height = bmp_height;
 		size = spr->byte_width * spr->height;
@@ -360,88 +723,19 @@ int main(int argc, char* argv[])
 		}
 		
 		
+		for (s = 0; s < 8; s++)
+			preshift_bytes += ((spr->width+s+7)/8) * spr->height * 2;
+
 		// generate pre-shifted bitmaps
 		for (s = 0; s < 8; s++)
 		{
-			printf("const uint8_t %s_bmap_%d[%d*%d*2] PROGMEM =\n", spr->name, s, (spr->width+s+7)/8, spr->height);
-			printf("{\n");
-
-			printf("// Bitmap shift %d (%d+%d x %d):\n", s, spr->width, s, spr->height);
-			if (verbose > 0)
+			// runtime shifted sprites only store shift 0 (draw_sprites() shifts it as needed)
+			if (s == 0 || !spr->runtime_shift)
 			{
-				printf("// Mask bitmap (%d x %d):\n", spr->width, spr->height);
-				for (y = 0; y < spr->height; y++)
-				{
-					printf("// ");
-					for (x = 0; x < spr->width+s; x += 8)
-					{
-						uint8_t b = spr->mask_bitmap[(y * spr->byte_width) + (x/8)];
-						printf("%s%s%s%s%s%s%s%s", b & 0x80 ? "#" : ".",
-									   b & 0x40 ? "#" : ".",
-									   b & 0x20 ? "#" : ".",
-									   b & 0x10 ? "#" : ".",
-									   b & 0x08 ? "#" : ".",
-									   b & 0x04 ? "#" : ".",
-									   b & 0x02 ? "#" : ".",
-									   b & 0x01 ? "#" : ".");
-					}
-					printf("\n");
-				}
-				printf("// Monochrome bitmap (%d+%d x %d):\n", spr->width, s, spr->height);
-				for (y = 0; y < spr->height; y++)
-				{
-					printf("// ");
-					for (x = 0; x < spr->width+s; x += 8)
-					{
-						uint8_t b = spr->mono_bitmap[(y * spr->byte_width) + (x/8)];
-						printf("%s%s%s%s%s%s%s%s", b & 0x80 ? "#" : ".",
-									   b & 0x40 ? "#" : ".",
-									   b & 0x20 ? "#" : ".",
-									   b & 0x10 ? "#" : ".",
-									   b & 0x08 ? "#" : ".",
-									   b & 0x04 ? "#" : ".",
-									   b & 0x02 ? "#" : ".",
-									   b & 0x01 ? "#" : ".");
-					}
-					printf("\n");
-				}
-			}
-			for (x = 0; x < spr->width+s; x += 8)
-			{
-				printf("\t");
-				for (y = 0; y < spr->height; y++)
-				{
-					uint8_t b = spr->mono_bitmap[(y * spr->byte_width) + (x/8)];
-					uint8_t m = spr->mask_bitmap[(y * spr->byte_width) + (x/8)];
-					if (human_readable)
-					{
-						printf("_( %s%s%s%s%s%s%s%s ),", m & 0x80 ? "W" : "_",
-										 m & 0x40 ? "W" : "_",
-										 m & 0x20 ? "W" : "_",
-										 m & 0x10 ? "W" : "_",
-										 m & 0x08 ? "W" : "_",
-										 m & 0x04 ? "W" : "_",
-										 m & 0x02 ? "W" : "_",
-										 m & 0x01 ? "W" : "_");
-						printf("_( %s%s%s%s%s%s%s%s ),", b & 0x80 ? "W" : "_",
-										 b & 0x40 ? "W" : "_",
-										 b & 0x20 ? "W" : "_",
-										 b & 0x10 ? "W" : "_",
-										 b & 0x08 ? "W" : "_",
-										 b & 0x04 ? "W" : "_",
-										 b & 0x02 ? "W" : "_",
-										 b & 0x01 ? "W" : "_");
-					}
-					else
-					{
-						printf("0x%02x,", m);
-						printf("0x%02x,", b);
-					}
-				}
-				printf("\n");
+				print_bitmap(spr, s);
+				flash_bytes += ((spr->width+s+7)/8) * spr->height * 2;
 			}
-
-			printf("};\n\n");
+			print_spans(spr, s);
 
 			// shift bits
 			for (y = 0; y < spr->height; y++)
@@ -468,7 +762,7 @@ int main(int argc, char* argv[])
 		}
 	}
 
-	printf("sprite_rom sprite_def[%d] =\n", num_sprites+1);
+	printf("const sprite_rom sprite_def[%d] PROGMEM =\n", num_sprites+1);
 	printf("{\n");
 	for (i = 0; i < num_sprites; i++)
 	{
@@ -477,7 +771,16 @@ int main(int argc, char* argv[])
 		printf("		%d, %d,	// #%d \"%s\"\n", spr->width, spr->height, i, spr->name);
 		printf("		{\n");
 		for (j = 0; j < 8; j++)
-			printf("			%s_bmap_%d,\n", spr->name, j);
+		{
+			if (j == 0 || !spr->runtime_shift)
+				printf("			%s_bmap_%d,\n", spr->name, j);
+			else
+				printf("			0,	// runtime shifted\n");
+		}
+		printf("		},\n");
+		printf("		{\n");
+		for (j = 0; j < 8; j++)
+			printf("			%s_span_%d,\n", spr->name, j);
 		printf("		},\n");
 		printf("	},\n");
 	}
@@ -493,9 +796,15 @@ int main(int argc, char* argv[])
 	printf("	SPRITE_NUM_IMAGES = %d\n", num_sprites);
 	printf("};\n");
 
+	if (num_anims)
+		print_anims();
+	if (num_metas)
+		print_metas();
+
 	
 	if (human_readable)
 		printf("#undef _\n");
+	printf("// Sprite image flash: %d bytes (%d if all pre-shifted)\n", flash_bytes, preshift_bytes);
 	printf("// EOF\n");
 	fprintf(stderr, "Done!\n");
 
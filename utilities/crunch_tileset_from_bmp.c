@@ -29,6 +29,7 @@ int32_t height;
 uint8_t *mono_bitmap;
 char tilesetname_str[64];
 uint8_t *tileset;
+uint8_t *priority;			// per tile sprite priority masks (set pixels of -s tiles)
 uint8_t *tilemap;
 uint8_t *curtile;
 
@@ -41,6 +42,7 @@ uint8_t permit_dupes = 0;
 uint8_t font_only = 0;
 uint8_t human_readable = 0;
 uint8_t verbose = 0;
+uint8_t solid_next = 0;			// tiles of next BMP hide sprites
 int32_t max_tiles = 256;
 
 uint8_t premable_done = 0;
@@ -132,7 +134,7 @@ const char *charname(int c)
 
 int main(int argc, char* argv[])
 {
-	int32_t i, x, y;
+	int32_t i, x, y, l;
 	int32_t arg;
 	int32_t newtiles;
 	int32_t dupetiles;
@@ -183,6 +185,10 @@ int main(int argc, char* argv[])
 					human_readable ^= 1;
 					break;
 
+				case 's':
+					solid_next = 1;
+					break;
+
 				case 'm':
 				{
 					char *numstr = &argv[arg][2];
@@ -228,6 +234,7 @@ int main(int argc, char* argv[])
 					printf(" -l         - Use linear gamma 1.0 when mapping RGB to luminance\n");
 					printf(" -i         - Use identity mapping RGB to luminance (R+G+B/3)\n");
 					printf(" -d         - Use ordered 2x2 dither instead of Floyd–Steinberg\n");
+					printf(" -s         - Set pixels of tiles in next BMP hide sprites (adds <name>_priority8x8 mask table)\n");
 					printf("\n");
 					printf("Output will go to stdout, so use \"> output\" to redirect to file.\n");
 					exit(1);
@@ -637,6 +644,22 @@ int main(int argc, char* argv[])
 					printf("=%02x ", (uint8_t)i);
 
 				tilemap[((y / TILE_Y) * (width / TILE_X)) + (x / TILE_X)] = (uint8_t)i;
+
+				if (solid_next)
+				{
+					if (!priority)
+					{
+						priority = malloc(TILE_BYTES * (MAX_TILES + 1));
+						if (!priority)
+						{
+							fprintf(stderr, "Failed allocating %d bytes.\n", TILE_BYTES * (MAX_TILES + 1));
+							exit(5);
+						}
+						memset(priority, 0, TILE_BYTES * (MAX_TILES + 1));
+					}
+					for (l = 0; l < TILE_Y; l++)
+						priority[(i * TILE_BYTES) + l] |= tileset[(i * TILE_BYTES) + l];
+				}
 			}
 			printf("\n");
 		}
@@ -698,6 +721,7 @@ int main(int argc, char* argv[])
 		if (tilesetname_str[0] == 0)
 			strncpy(tilesetname_str, name_str, sizeof (tilesetname_str)-1);
 		memset(name_str, 0, sizeof (name_str));
+		solid_next = 0;
 	}
 	
 	printf("const uint8_t %s_font8x8[%d*%d] PROGMEM __attribute__ ((aligned(256))) =\n", tilesetname_str, TILE_Y, max_tiles);
@@ -732,6 +756,22 @@ int main(int argc, char* argv[])
 		printf("\n");
 	}
 	printf("};\n\n");
+
+	if (priority)
+	{
+		// same layout as font, so sprite engine steps through it with the font
+		printf("// Sprite priority masks (set bits are background pixels drawn in front of sprites)\n");
+		printf("const uint8_t %s_priority8x8[%d*%d] PROGMEM __attribute__ ((aligned(256))) =\n", tilesetname_str, TILE_Y, max_tiles);
+		printf("{\n");
+		for (y = 0; y < TILE_Y; y++)
+		{
+			printf("\t");
+			for (i = 0; i < max_tiles; i++)
+				printf("0x%02x,", priority[(i * TILE_BYTES) + y]);
+			printf("\n");
+		}
+		printf("};\n\n");
+	}
 	printf("// EOF\n");
 	fprintf(stderr, "Done!\n");
 
@@ -0,0 +1,18 @@
+// Host stand-in for avr-libc <avr/pgmspace.h> (for utilities that build sketch code on the host, e.g., render_audio)
+//
+// PROGMEM data goes in section audio_flash so 256 byte aligned wave tables keep their alignment relative to
+// __start_audio_flash (see AUDIO_WAVE in AVRInvaders_audio.h).
+
+#ifndef HOST_PGMSPACE_H
+#define HOST_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM			__attribute__((section("audio_flash")))
+#define pgm_read_byte(p)	(*(const uint8_t *)(p))
+#define pgm_read_word(p)	(*(const uint16_t *)(p))
+#define pgm_read_ptr(p)		(*(const void * const *)(p))
+#define memcpy_P		memcpy
+
+#endif
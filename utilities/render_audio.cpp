@@ -0,0 +1,246 @@
+// Host build of the sketch audio mixer (AVRInvaders_audio.h) rendering mixer output to a WAV file
+//
+// Uses the C versions of the voice, noise and volume code (asm is only used for __AVR__) and the sketch's wave
+// tables, title music and zap sample, stepping music and envelopes once a frame and mixing one sample per scanline
+// like loop() and mixaudio_buffer() in the sketch.  Use -c to print a checksum for regression tests and -r for raw
+// samples to compare with OCR2A captured from a simulator running the sketch.
+//
+// Build with the same AUDIO_* defines as the sketch (defaults below match AVRInvaders.ino), e.g.:
+//
+//	make render_audio CXXFLAGS=-DAUDIO_MULFREE=1
+
+#if !defined(ARDUINO)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "AVRInvaders_video_settings.h"		// TV_MODE (and host <avr/pgmspace.h> from utilities/host)
+
+#ifndef AUDIO_VOICES
+#define AUDIO_VOICES		3
+#endif
+#ifndef AUDIO_VOLUME
+#define AUDIO_VOLUME		1
+#endif
+#ifndef AUDIO_PHASE24
+#define AUDIO_PHASE24		0
+#endif
+#ifndef AUDIO_NOISE
+#define AUDIO_NOISE		1
+#endif
+#ifndef AUDIO_MUSIC
+#define AUDIO_MUSIC		1
+#endif
+#ifndef AUDIO_ENVELOPE
+#define AUDIO_ENVELOPE		1
+#endif
+#ifndef AUDIO_SAMPLES
+#define AUDIO_SAMPLES		1
+#endif
+
+#include "AVRInvaders_audio.h"
+#include "audio_waves.cpp"
+
+audio_voice	audio_voices[AUDIO_VOICES];
+#if AUDIO_NOISE
+audio_noise_voice	audio_noise = { 0, 0, 0xace1, 0 };
+#endif
+#if AUDIO_ENVELOPE
+audio_envelope_state	audio_envelopes[AUDIO_VOICES];
+#endif
+#if AUDIO_SAMPLES
+audio_sample_state	audio_sample_voice;
+#endif
+#if AUDIO_MUSIC
+audio_music_state	audio_music;
+#include "title_music.h"
+#endif
+#if AUDIO_SAMPLES
+#include "zap_sample.h"
+#endif
+
+#if TV_MODE == PAL
+#define LINES_FRAME	_PAL_LINE_FRAME
+#else
+#define LINES_FRAME	_NTSC_LINE_FRAME
+#endif
+
+static void put_le(FILE *f, uint32_t v, int32_t n)
+{
+	while (n--)
+	{
+		fputc(v & 0xff, f);
+		v >>= 8;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int32_t arg, i;
+	double seconds = 10.0;
+	int32_t zap_frame = -1;
+	int32_t noise = 0, music = 1, raw = 0, checksum = 0, verbose = 0;
+	const char *out_name = NULL;
+	FILE *f;
+
+	for (arg = 1; arg < argc; arg++)
+	{
+		if (argv[arg][0] == '-')
+		{
+			char c = argv[arg][1];
+			if (c >= 'A' && c <= 'Z')
+			c += 32;
+			switch(c)
+			{
+			case 's':
+			case 'z':
+			{
+				char *numstr = &argv[arg][2];
+
+				if (*numstr == 0 && arg+1 < argc)
+				numstr = argv[++arg];
+
+				if (c == 's')
+					seconds = atof(numstr);
+				else
+					zap_frame = atoi(numstr);
+
+				break;
+			}
+
+			case 'n':
+				noise ^= 1;
+				break;
+
+			case 'q':
+				music ^= 1;
+				break;
+
+			case 'r':
+				raw ^= 1;
+				break;
+
+			case 'c':
+				checksum ^= 1;
+				break;
+
+			case 'v':
+				verbose = (verbose + 1) & 0x3;
+				break;
+
+			default:
+				printf("Usage: render_audio [options ...] <output WAV>\n");
+				printf("\n");
+				printf(" -s <seconds>	- Length to render (default 10)\n");
+				printf(" -z <frame>	- Play zap sample at frame\n");
+				printf(" -n	 - Noise voice engine rumble (as game screen)\n");
+				printf(" -q	 - No title music\n");
+				printf(" -r	 - Raw unsigned 8-bit samples (no WAV header)\n");
+				printf(" -c	 - Print FNV-1a checksum of samples\n");
+				printf(" -v	 - Verbose\n");
+				exit(1);
+
+				break;
+			}
+
+			continue;
+		}
+		out_name = argv[arg];
+	}
+
+	if (!out_name)
+	{
+		fprintf(stderr, "Need output WAV (-h for help).\n");
+		exit(5);
+	}
+	if ((f = fopen(out_name, "wb")) == NULL)
+	{
+		fprintf(stderr, "Error creating output \"%s\".\n", out_name);
+		exit(5);
+	}
+
+	// same voice setup as sketch
+	for (uint8_t v = 0; v < AUDIO_VOICES; v++)
+		audio_voices[v].wave = AUDIO_WAVE(v == 2 ? TriTable : SinTable);
+	audio_voices[0].freq = 0x0100;
+#if AUDIO_VOICES > 2
+	audio_voices[1].freq = 0x0380;
+	audio_voices[2].freq = 0x0080;
+#endif
+#if AUDIO_MUSIC
+	if (music)
+		audio_music_play(&title_music_song);
+#endif
+#if AUDIO_NOISE
+	if (noise)
+	{
+		audio_noise.freq = 0x30;
+		audio_noise.vol = 0x0f;
+	}
+#endif
+
+	uint32_t rate = (uint32_t)(AUDIO_RATE + 0.5);
+	int32_t frames = (int32_t)(seconds * rate / LINES_FRAME + 0.5);
+	uint32_t length = frames * LINES_FRAME;
+	if (!raw)
+	{
+		fwrite("RIFF", 1, 4, f);
+		put_le(f, 36 + length, 4);
+		fwrite("WAVEfmt ", 1, 8, f);
+		put_le(f, 16, 4);
+		put_le(f, 1, 2);			// PCM
+		put_le(f, 1, 2);			// mono
+		put_le(f, rate, 4);
+		put_le(f, rate, 4);			// bytes per second
+		put_le(f, 1, 2);			// block align
+		put_le(f, 8, 2);			// bits per sample (unsigned)
+		fwrite("data", 1, 4, f);
+		put_le(f, length, 4);
+	}
+
+	uint32_t hash = 2166136261u;
+	for (int32_t frame = 0; frame < frames; frame++)
+	{
+#if AUDIO_SAMPLES
+		if (frame == zap_frame)
+			audio_sample_play(&zap_sample, 160);
+#endif
+#if AUDIO_MUSIC
+		audio_music_frame();
+#endif
+#if AUDIO_ENVELOPE
+		audio_envelope_frame();
+#endif
+		for (i = 0; i < LINES_FRAME; )
+		{
+			uint8_t buf[32];
+			uint8_t n = (LINES_FRAME - i) > 32 ? 32 : (LINES_FRAME - i);
+#if AUDIO_SAMPLES
+			int8_t pcm[32];
+			audio_sample_decode(pcm, n);
+			for (uint8_t j = 0; j < n; j++)
+				buf[j] = audio_sample_add(mixsample(), pcm[j]);
+#else
+			for (uint8_t j = 0; j < n; j++)
+				buf[j] = mixsample();
+#endif
+			for (uint8_t j = 0; j < n; j++)
+				hash = (hash ^ buf[j]) * 16777619u;
+			fwrite(buf, 1, n, f);
+			i += n;
+		}
+	}
+	fclose(f);
+
+	if (verbose)
+		fprintf(stderr, "%d frames, %u samples at %u Hz, estimated %d mix cycles per sample.\n", frames, length, rate, AUDIO_MIX_CYCLES);
+	if (checksum)
+		printf("%08x\n", hash);
+	fprintf(stderr, "Done!\n");
+
+	return 0;
+}
+
+#endif
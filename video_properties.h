@@ -34,6 +34,9 @@
 #define	TARGET_F_CPU F_CPU
 #endif
 
+#define	NTSC		(0)
+#define	PAL		(1)
+
 #define _CYCLES_PER_US			(TARGET_F_CPU / 1000000)
 
 #define _TIME_HORZ_SYNC			4.7
@@ -0,0 +1,86 @@
+// Sample "zap" from "zap.wav" (crunch_sample): 2359 samples at 15734.2 Hz, 4-bit IMA ADPCM (1180 bytes)
+
+const uint8_t zap_data[1180] PROGMEM =
+{
+	0x77, 0x77, 0xff, 0xff, 0x7f, 0x13, 0xf2, 0x9c, 0x51, 0x10, 0xa9, 0x8c, 0x08, 0x17, 0x08, 0xf0,
+	0x88, 0x60, 0x80, 0xd0, 0x1a, 0x28, 0x05, 0x08, 0xe9, 0x19, 0x60, 0x08, 0xe8, 0x08, 0x49, 0x83,
+	0x00, 0xcc, 0x00, 0x50, 0x80, 0xf0, 0x80, 0x50, 0x01, 0x19, 0x9d, 0x98, 0x43, 0x80, 0xf8, 0x08,
+	0x00, 0x06, 0x08, 0x9d, 0x08, 0x70, 0x18, 0xc8, 0x1b, 0x00, 0x86, 0x81, 0xe9, 0x00, 0x68, 0x08,
+	0x09, 0x0e, 0x18, 0x04, 0x08, 0xc8, 0x89, 0x10, 0x07, 0x98, 0xb9, 0x88, 0x71, 0x80, 0x91, 0x8d,
+	0x88, 0x16, 0x08, 0xf8, 0x88, 0x40, 0x82, 0x80, 0xac, 0x80, 0x61, 0x80, 0x90, 0x8d, 0x00, 0x50,
+	0x00, 0xe8, 0x08, 0x08, 0x06, 0x80, 0xf0, 0x08, 0x69, 0x80, 0x81, 0x0f, 0x08, 0x78, 0x08, 0xc0,
+	0x8a, 0x00, 0x43, 0x19, 0xc8, 0x8a, 0x09, 0x17, 0x00, 0xda, 0x80, 0x29, 0x15, 0x88, 0xe8, 0x08,
+	0x80, 0x86, 0x08, 0x0e, 0x80, 0x78, 0x88, 0x81, 0x8e, 0x91, 0x51, 0x00, 0x88, 0x8e, 0x08, 0x60,
+	0x18, 0x88, 0x0f, 0x08, 0x15, 0x19, 0xe9, 0x80, 0x08, 0x05, 0x08, 0xd0, 0x08, 0x08, 0x14, 0x08,
+	0xd8, 0x09, 0x09, 0x07, 0x00, 0xe8, 0x09, 0x18, 0x05, 0x88, 0xe1, 0x88, 0x91, 0x15, 0x08, 0xd8,
+	0x08, 0x88, 0x78, 0x80, 0x18, 0x8e, 0x80, 0x78, 0x80, 0x08, 0x8e, 0x80, 0x50, 0x80, 0x00, 0x0e,
+	0x98, 0x11, 0x04, 0x90, 0xe9, 0x81, 0x29, 0x85, 0x80, 0xba, 0x08, 0x09, 0x27, 0x80, 0xe0, 0x09,
+	0x08, 0x04, 0x00, 0xd8, 0x88, 0x08, 0x79, 0x81, 0x18, 0x8f, 0x80, 0x10, 0x86, 0x08, 0xd9, 0x00,
+	0x18, 0x84, 0x80, 0xc1, 0x0c, 0x81, 0x23, 0x81, 0xa0, 0x9f, 0x81, 0x78, 0x08, 0x08, 0xe8, 0x80,
+	0x18, 0x85, 0x80, 0xa0, 0x9a, 0x28, 0x32, 0x82, 0x28, 0xef, 0x00, 0x58, 0x00, 0x88, 0xd8, 0x80,
+	0x08, 0x32, 0x00, 0xb9, 0x1e, 0x08, 0x58, 0x92, 0x91, 0xf0, 0x09, 0x00, 0x78, 0x90, 0x80, 0x8c,
+	0x80, 0x30, 0x02, 0x00, 0xf8, 0x99, 0x91, 0x78, 0x01, 0x09, 0x8c, 0x88, 0x11, 0x05, 0x88, 0xd8,
+	0x09, 0x88, 0x70, 0x81, 0x88, 0xc8, 0x08, 0x08, 0x05, 0x81, 0x88, 0x8f, 0x80, 0x10, 0x04, 0x90,
+	0xa0, 0x9c, 0x08, 0x71, 0x00, 0x18, 0xe9, 0x88, 0x80, 0x42, 0x18, 0x09, 0xac, 0x19, 0x90, 0x27,
+	0x08, 0x08, 0xac, 0x98, 0x91, 0x27, 0x08, 0x89, 0x0e, 0x19, 0x18, 0x05, 0x08, 0xf0, 0x80, 0x19,
+	0x00, 0x04, 0x19, 0xc8, 0x8a, 0x08, 0x71, 0x80, 0x91, 0xa0, 0x0d, 0x08, 0x68, 0x00, 0x80, 0xf8,
+	0x80, 0x80, 0x30, 0x82, 0x08, 0xf8, 0x08, 0x08, 0x10, 0x85, 0x08, 0xe8, 0x88, 0x91, 0x10, 0x85,
+	0x01, 0x89, 0x0f, 0x08, 0x88, 0x87, 0x80, 0x80, 0x8c, 0x18, 0x19, 0x05, 0x09, 0x00, 0xbc, 0x80,
+	0x80, 0x71, 0x81, 0x80, 0xf0, 0x08, 0x90, 0x78, 0x08, 0x80, 0xb8, 0x88, 0x19, 0x28, 0x06, 0x00,
+	0x89, 0x0f, 0x88, 0x80, 0x42, 0x08, 0x18, 0xf0, 0x09, 0x88, 0x31, 0x93, 0x28, 0xa0, 0xbf, 0x01,
+	0x08, 0x17, 0x88, 0x88, 0xe8, 0x88, 0x81, 0x78, 0x00, 0x88, 0x90, 0xab, 0x82, 0x0a, 0x27, 0x08,
+	0x88, 0xf0, 0x88, 0x00, 0x28, 0x04, 0x09, 0x80, 0x8f, 0x80, 0x88, 0x25, 0x09, 0x80, 0xb8, 0xab,
+	0x81, 0x98, 0x67, 0x88, 0x00, 0xf8, 0x18, 0x88, 0x38, 0x83, 0x88, 0x00, 0xfb, 0x90, 0x00, 0x78,
+	0x80, 0x80, 0x80, 0x0e, 0x08, 0x18, 0x31, 0x08, 0x88, 0x00, 0xaf, 0x08, 0x00, 0x79, 0x81, 0x01,
+	0x88, 0x8f, 0x88, 0x81, 0x23, 0x00, 0x80, 0xc8, 0x0e, 0x89, 0x82, 0x70, 0x81, 0x80, 0x90, 0x8f,
+	0x08, 0x08, 0x78, 0x80, 0x18, 0x88, 0x9c, 0x00, 0x80, 0x78, 0x00, 0x88, 0x80, 0xab, 0x09, 0x88,
+	0x32, 0x07, 0x00, 0x18, 0xda, 0x8b, 0x90, 0x01, 0x64, 0x00, 0x29, 0x8a, 0x8f, 0x08, 0x09, 0x71,
+	0x80, 0x08, 0x08, 0xe9, 0x80, 0x80, 0x00, 0x87, 0x80, 0x00, 0x98, 0x0d, 0x09, 0x80, 0x71, 0x08,
+	0x00, 0x88, 0xda, 0x80, 0x08, 0x00, 0x63, 0x90, 0x80, 0xb1, 0x0f, 0x88, 0x00, 0x59, 0x93, 0x28,
+	0x98, 0xf1, 0x8a, 0x00, 0x90, 0x78, 0x02, 0x89, 0x01, 0xf8, 0x89, 0x80, 0x81, 0x79, 0x00, 0x80,
+	0x00, 0xf9, 0x80, 0x80, 0x90, 0x53, 0x19, 0x19, 0x09, 0xac, 0x08, 0x80, 0x18, 0x70, 0x21, 0x98,
+	0x10, 0xfa, 0x99, 0x10, 0x99, 0x73, 0x81, 0x00, 0x98, 0xf2, 0x99, 0x00, 0x80, 0x78, 0x00, 0x80,
+	0x18, 0x99, 0x8e, 0x90, 0x00, 0x08, 0x07, 0x81, 0x18, 0x09, 0x9f, 0x81, 0x88, 0x10, 0x62, 0x09,
+	0x88, 0x01, 0xf0, 0x0a, 0x18, 0x08, 0x18, 0x07, 0x90, 0x00, 0x80, 0x8f, 0x90, 0x00, 0x88, 0x61,
+	0x80, 0x80, 0x80, 0xf1, 0x88, 0x80, 0x88, 0x81, 0x71, 0x80, 0x08, 0x80, 0xf0, 0x09, 0x80, 0x00,
+	0x98, 0x17, 0x08, 0x08, 0x91, 0xf8, 0x88, 0x00, 0x98, 0x92, 0x26, 0x89, 0x10, 0x89, 0xf1, 0x1a,
+	0x80, 0x19, 0x88, 0x17, 0x80, 0x08, 0x90, 0xf2, 0x0a, 0x08, 0x18, 0x90, 0x71, 0x10, 0x88, 0x88,
+	0x91, 0x9f, 0x08, 0x90, 0x01, 0x08, 0x17, 0x80, 0x08, 0x10, 0xfa, 0x09, 0x08, 0x88, 0x91, 0x73,
+	0x01, 0x88, 0x18, 0x89, 0xec, 0x08, 0x08, 0x81, 0x08, 0x54, 0x08, 0x00, 0x09, 0xa1, 0xbf, 0x81,
+	0x19, 0x89, 0x10, 0x37, 0x00, 0x88, 0x91, 0xa1, 0xcf, 0x80, 0x18, 0x08, 0x39, 0x44, 0x10, 0x1a,
+	0xb1, 0x83, 0xef, 0x00, 0x88, 0x80, 0x80, 0x45, 0x19, 0x08, 0x08, 0x88, 0xf0, 0x8b, 0x00, 0x90,
+	0x88, 0x10, 0x47, 0x00, 0x09, 0x88, 0x11, 0xbf, 0x08, 0x09, 0x10, 0xa9, 0x47, 0x00, 0x88, 0xa1,
+	0x91, 0x11, 0xcf, 0x00, 0x98, 0x00, 0x88, 0x73, 0x92, 0x18, 0x98, 0x01, 0xf8, 0x0b, 0x18, 0x99,
+	0x81, 0x19, 0x73, 0x83, 0x01, 0x89, 0x10, 0x09, 0xdf, 0x90, 0x88, 0x92, 0x91, 0x50, 0x87, 0x80,
+	0x00, 0xa0, 0x00, 0xf0, 0x0b, 0x88, 0x92, 0x08, 0x18, 0x56, 0x08, 0x19, 0x90, 0x81, 0x00, 0xee,
+	0x08, 0x91, 0x00, 0x98, 0x81, 0x72, 0x82, 0x09, 0x81, 0x19, 0x88, 0xf8, 0x8b, 0x00, 0xa0, 0x18,
+	0xa1, 0x72, 0x86, 0x80, 0x81, 0x89, 0x00, 0x08, 0xbf, 0x08, 0x08, 0x3a, 0x99, 0xb3, 0x77, 0x18,
+	0x09, 0x00, 0x19, 0x19, 0xf8, 0x8b, 0x81, 0x00, 0x19, 0x19, 0x90, 0x47, 0x80, 0x18, 0x09, 0x10,
+	0x3a, 0xfb, 0x8c, 0x29, 0x19, 0x89, 0x90, 0x11, 0x70, 0x86, 0x08, 0x91, 0x01, 0x1a, 0x09, 0xbf,
+	0x80, 0x89, 0x38, 0x89, 0x02, 0x3a, 0x74, 0x94, 0x00, 0x98, 0x02, 0x18, 0x8b, 0xf8, 0x8f, 0x91,
+	0x08, 0x91, 0x01, 0x09, 0x78, 0x04, 0xa0, 0x81, 0x88, 0x30, 0x08, 0xf8, 0x0f, 0x08, 0x80, 0x08,
+	0x19, 0x88, 0x00, 0x37, 0x09, 0x91, 0xa1, 0x91, 0x91, 0x10, 0x98, 0xff, 0x80, 0x18, 0x19, 0x09,
+	0x80, 0xa0, 0x80, 0x67, 0x00, 0x08, 0x08, 0x89, 0x01, 0x1a, 0xf2, 0x8d, 0x90, 0x92, 0x18, 0xa8,
+	0x20, 0x98, 0xa2, 0x77, 0x80, 0x88, 0x01, 0x19, 0x88, 0x29, 0x90, 0xdf, 0x91, 0x08, 0x91, 0x18,
+	0x19, 0x90, 0xa1, 0x71, 0x07, 0x19, 0x08, 0x88, 0x18, 0x90, 0x80, 0x90, 0xf0, 0x0e, 0x88, 0x80,
+	0x28, 0x88, 0x98, 0x01, 0x20, 0x88, 0x77, 0x80, 0x08, 0x18, 0x89, 0x28, 0x0a, 0x02, 0x3b, 0xff,
+	0x90, 0x08, 0x81, 0x88, 0x81, 0xa8, 0x82, 0x00, 0x59, 0x37, 0x88, 0xa1, 0x18, 0x28, 0x09, 0x80,
+	0x09, 0x01, 0xdb, 0xff, 0x80, 0x18, 0x90, 0x18, 0x0a, 0x01, 0x18, 0x2b, 0xe3, 0x37, 0x81, 0x08,
+	0x08, 0x88, 0x20, 0x0c, 0x94, 0x8a, 0x00, 0x91, 0xff, 0x08, 0x90, 0x80, 0x10, 0x09, 0x10, 0x1b,
+	0x92, 0x00, 0x8e, 0x67, 0x08, 0x19, 0x18, 0x08, 0x0a, 0x80, 0x19, 0x49, 0xa9, 0x82, 0x09, 0xff,
+	0x08, 0x08, 0x00, 0x89, 0x00, 0x18, 0x3a, 0x08, 0x10, 0x9a, 0x60, 0x7a, 0x96, 0x01, 0x88, 0x90,
+	0x11, 0x1b, 0x80, 0xe3, 0x81, 0xd2, 0x82, 0x80, 0xf0, 0x8b, 0x90, 0x01, 0x89, 0x30, 0x08, 0x9b,
+	0x22, 0x00, 0x1f, 0xd2, 0x80, 0x84, 0x78, 0x94, 0x18, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0xf8, 0x03, 0x08, 0x08, 0xff, 0xa0, 0x08, 0x80, 0x38, 0xc0, 0x10, 0x88, 0xb1, 0x53,
+	0xe8, 0x03, 0xd0, 0x30, 0x2c, 0x90, 0x12, 0x03, 0xc3, 0xb3, 0x48, 0x8b, 0x00, 0x88, 0x00, 0x88,
+	0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0xff, 0xbf, 0x08, 0x08, 0x88, 0x00, 0x88,
+	0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x77,
+	0x07, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08,
+};
+
+const audio_sample zap_sample PROGMEM =
+{
+	zap_data, 2359, AUDIO_SAMPLE_ADPCM4
+};
+
+// EOF